@@ -0,0 +1,177 @@
+#include "bench.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <sys/resource.h>
+#endif
+
+#if defined(__linux__)
+  #include <linux/perf_event.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+namespace gb::Bench {
+
+Options::Options(int argc, char** argv) {
+  for (auto i = 1; i < argc; i++) {
+    std::string_view arg = argv[i];
+    if (arg.substr(0, 2) != "--") {
+      continue;
+    }
+
+    arg.remove_prefix(2);
+    auto separator = arg.find('=');
+
+    if (separator != std::string_view::npos) {
+      values_[std::string(arg.substr(0, separator))] = std::string(arg.substr(separator + 1));
+    }
+    else if (i + 1 < argc && std::string_view(argv[i + 1]).substr(0, 2) != "--") {
+      values_[std::string(arg)] = argv[++i];
+    }
+    else {
+      values_[std::string(arg)] = "1";
+    }
+  }
+}
+
+bool Options::Has(std::string_view name) const {
+  return values_.find(std::string(name)) != values_.end();
+}
+
+int64_t Options::GetInt(std::string_view name, int64_t default_value) const {
+  auto it = values_.find(std::string(name));
+  return it != values_.end() ? std::strtoll(it->second.c_str(), nullptr, 10) : default_value;
+}
+
+double Options::GetDouble(std::string_view name, double default_value) const {
+  auto it = values_.find(std::string(name));
+  return it != values_.end() ? std::strtod(it->second.c_str(), nullptr) : default_value;
+}
+
+std::string Options::GetString(std::string_view name, std::string_view default_value) const {
+  auto it = values_.find(std::string(name));
+  return it != values_.end() ? it->second : std::string(default_value);
+}
+
+Report::Report(std::string_view bench) {
+  buffer_.append(std::string_view("{\"bench\":"));
+  WriteString(bench);
+}
+
+Report& Report::Add(std::string_view key, double value) {
+  WriteKey(key);
+  // JSON не допускает NaN и бесконечности.
+  if (std::isfinite(value)) {
+    fmt::format_to(std::back_inserter(buffer_), "{:.6g}", value);
+  } else {
+    buffer_.append(std::string_view("null"));
+  }
+  return *this;
+}
+
+Report& Report::Add(std::string_view key, std::string_view value) {
+  WriteKey(key);
+  WriteString(value);
+  return *this;
+}
+
+void Report::Print() {
+  fmt::format_to(std::back_inserter(buffer_), ",\"peak_rss_bytes\":{}}}\n", GetPeakRssBytes());
+  std::fwrite(buffer_.data(), 1, buffer_.size(), stdout);
+  std::fflush(stdout);
+}
+
+void Report::WriteKey(std::string_view key) {
+  buffer_.push_back(',');
+  WriteString(key);
+  buffer_.push_back(':');
+}
+
+void Report::WriteString(std::string_view text) {
+  buffer_.push_back('"');
+  for (auto c : text) {
+    // Байты UTF-8 больше 0x7F записываются как есть: JSON допускает их в строках.
+    if (c == '"' || c == '\\') {
+      buffer_.push_back('\\');
+      buffer_.push_back(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      fmt::format_to(std::back_inserter(buffer_), "\\u{:04x}", static_cast<unsigned>(c));
+    } else {
+      buffer_.push_back(c);
+    }
+  }
+  buffer_.push_back('"');
+}
+
+CacheMissCounter::CacheMissCounter() {
+#if defined(__linux__)
+  perf_event_attr attr{};
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = PERF_COUNT_HW_CACHE_MISSES;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+}
+
+CacheMissCounter::~CacheMissCounter() noexcept {
+#if defined(__linux__)
+  if (fd_ >= 0) {
+    close(fd_);
+  }
+#endif
+}
+
+void CacheMissCounter::Start() {
+#if defined(__linux__)
+  if (fd_ >= 0) {
+    ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+void CacheMissCounter::Stop() {
+#if defined(__linux__)
+  if (fd_ >= 0) {
+    ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+  }
+#endif
+}
+
+int64_t CacheMissCounter::GetCount() const {
+#if defined(__linux__)
+  auto count = int64_t{0};
+  if (fd_ >= 0 && read(fd_, &count, sizeof(count)) == static_cast<ssize_t>(sizeof(count))) {
+    return count;
+  }
+#endif
+  return -1;
+}
+
+size_t GetPeakRssBytes() {
+#if defined(__unix__) || defined(__APPLE__)
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+
+  #if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);
+  #else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+  #endif
+#else
+  return 0;
+#endif
+}
+
+} // namespace gb::Bench
@@ -0,0 +1,137 @@
+#ifndef GUIDING_BREEZE_BENCH_BENCH_H
+#define GUIDING_BREEZE_BENCH_BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include "fmt/format.h"
+
+namespace gb::Bench {
+
+/**
+ * @brief Параметры командной строки вида "--name=value" или "--name value".
+ */
+class Options final {
+private:
+  std::unordered_map<std::string, std::string> values_;
+
+public:
+  Options(int argc, char** argv);
+
+public:
+  [[nodiscard]] bool Has(std::string_view name) const;
+  [[nodiscard]] int64_t GetInt(std::string_view name, int64_t default_value) const;
+  [[nodiscard]] double GetDouble(std::string_view name, double default_value) const;
+  [[nodiscard]] std::string GetString(std::string_view name, std::string_view default_value) const;
+};
+
+/**
+ * @brief Машиночитаемый результат бенчмарка: одна строка JSON в stdout.
+ */
+class Report final {
+private:
+  fmt::memory_buffer buffer_;
+
+public:
+  /**
+   * @brief Начать результат.
+   *
+   * @param bench Имя бенчмарка; выводится в поле "bench".
+   */
+  explicit Report(std::string_view bench);
+
+public:
+  Report& Add(std::string_view key, double value);
+  Report& Add(std::string_view key, std::string_view value);
+
+  template<typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+  Report& Add(std::string_view key, T value) {
+    WriteKey(key);
+    fmt::format_to(std::back_inserter(buffer_), "{}", value);
+    return *this;
+  }
+
+  /**
+   * @brief Дополнить результат пиковым потреблением памяти и вывести его.
+   */
+  void Print();
+
+private:
+  void WriteKey(std::string_view key);
+  void WriteString(std::string_view text);
+};
+
+/**
+ * @brief Секундомер на основе steady_clock.
+ */
+class Stopwatch final {
+private:
+  std::chrono::steady_clock::time_point begin_;
+
+public:
+  Stopwatch() : begin_(std::chrono::steady_clock::now()) {}
+
+public:
+  void Restart() { begin_ = std::chrono::steady_clock::now(); }
+
+  [[nodiscard]] double GetSeconds() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin_).count();
+  }
+};
+
+/**
+ * @brief Счетчик промахов кэша последнего уровня в текущем потоке.
+ *
+ * На Linux использует аппаратный счетчик perf_event_open; если он недоступен (другая платформа,
+ * виртуальная машина или запрет kernel.perf_event_paranoid), счетчик не работает и GetCount
+ * возвращает -1.
+ */
+class CacheMissCounter final {
+private:
+  int fd_{-1};
+
+public:
+  CacheMissCounter();
+  CacheMissCounter(const CacheMissCounter&) = delete;
+  CacheMissCounter(CacheMissCounter&&) = delete;
+  ~CacheMissCounter() noexcept;
+
+public:
+  CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+  CacheMissCounter& operator=(CacheMissCounter&&) = delete;
+
+public:
+  /**
+   * @brief Обнулить счетчик и начать подсчет.
+   */
+  void Start();
+
+  /**
+   * @brief Остановить подсчет.
+   */
+  void Stop();
+
+  /**
+   * @brief Получить количество промахов между Start и Stop.
+   *
+   * @return int64_t Количество промахов или -1, если счетчик недоступен.
+   */
+  [[nodiscard]] int64_t GetCount() const;
+};
+
+/**
+ * @brief Получить пиковый размер резидентной памяти процесса.
+ *
+ * @return size_t Размер в байтах; 0, если платформа не поддерживается.
+ */
+[[nodiscard]] size_t GetPeakRssBytes();
+
+} // namespace gb::Bench
+
+#endif // GUIDING_BREEZE_BENCH_BENCH_H
@@ -0,0 +1,138 @@
+#include "bench.hpp"
+
+#include "core/components/test_component.hpp"
+#include "core/components/transform_component.hpp"
+#include "core/jobs/thread_pool.hpp"
+#include "core/systems/scheduler.hpp"
+#include "core/systems/system.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace {
+
+constexpr int kLifetime = 100; //< Время жизни сущности в тиках; за тик заменяется 1/kLifetime сущностей
+
+/**
+ * @brief Система, заменяющая сущности с истекшим временем жизни новыми через буферы команд.
+ */
+class SpawnSystem final : public gb::System {
+public:
+  explicit SpawnSystem(entt::registry* registry) : System(registry) {
+    Writes<gb::TestComponent>();
+  }
+
+public:
+  void Update(float) override {
+    ParallelEach<gb::TestComponent>([this](entt::entity entity, gb::TestComponent& test) {
+      if (++test.value < kLifetime) {
+        return;
+      }
+
+      auto& commands = GetCommands();
+      commands.Destroy(entity);
+
+      auto child = commands.Create();
+      commands.Emplace<gb::TestComponent>(child, 0);
+      commands.Emplace<gb::TransformComponent>(child, static_cast<float>(test.value), 0.0F);
+    });
+  }
+};
+
+/**
+ * @brief Заполнить реестр сущностями с равномерно распределенным возрастом.
+ */
+void Populate(entt::registry& registry, size_t entity_count) {
+  for (auto i = size_t{0}; i < entity_count; i++) {
+    auto entity = registry.create();
+    registry.emplace<gb::TestComponent>(entity, static_cast<int>(i % kLifetime));
+    registry.emplace<gb::TransformComponent>(entity, 0.0F, 0.0F);
+  }
+}
+
+/**
+ * @brief Тот же тик без буферов команд: последовательный перебор, затем изменения по одному.
+ */
+void UpdateDirect(entt::registry& registry, std::vector<entt::entity>& expired) {
+  expired.clear();
+  for (auto [entity, test] : registry.view<gb::TestComponent>().each()) {
+    if (++test.value >= kLifetime) {
+      expired.push_back(entity);
+    }
+  }
+
+  for (auto entity : expired) {
+    auto value = registry.get<gb::TestComponent>(entity).value;
+    registry.destroy(entity);
+
+    auto child = registry.create();
+    registry.emplace<gb::TestComponent>(child, 0);
+    registry.emplace<gb::TransformComponent>(child, static_cast<float>(value), 0.0F);
+  }
+}
+
+void Print(const char* mode, size_t entity_count, size_t threads, int64_t ticks, double seconds, size_t alive) {
+  gb::Bench::Report("command_buffer")
+    .Add("mode", mode)
+    .Add("entities", entity_count)
+    .Add("threads", threads)
+    .Add("spawned_per_tick", entity_count / kLifetime)
+    .Add("ms_per_tick", seconds * 1e3 / ticks)
+    .Add("alive", alive)
+    .Print();
+}
+
+} // namespace
+
+/**
+ * @brief Замена сущностей через буферы команд в параллельной системе против последовательного варианта.
+ *
+ * Каждый тик 1/100 сущностей уничтожается и заменяется новой сущностью с двумя компонентами.
+ *
+ * Параметры:
+ *   --entities N  Количество сущностей (по умолчанию 1000000).
+ *   --ticks N     Количество тиков (по умолчанию 100).
+ *   --threads N   Количество потоков (по умолчанию - количество ядер).
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto entity_count = static_cast<size_t>(std::max<int64_t>(1, options.GetInt("entities", 1'000'000)));
+  auto tick_count = std::max<int64_t>(1, options.GetInt("ticks", 100));
+  auto threads = static_cast<size_t>(
+    std::max<int64_t>(1, options.GetInt("threads", std::max(1U, std::thread::hardware_concurrency())))
+  );
+
+  {
+    entt::registry registry;
+    Populate(registry, entity_count);
+    std::vector<entt::entity> expired;
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto tick = int64_t{0}; tick < tick_count; tick++) {
+      UpdateDirect(registry, expired);
+    }
+    Print("direct", entity_count, 1, tick_count, stopwatch.GetSeconds(), registry.storage<gb::TestComponent>().size());
+  }
+
+  {
+    entt::registry registry;
+    Populate(registry, entity_count);
+
+    gb::ThreadPool pool(threads - 1);
+    gb::Scheduler scheduler(&pool);
+    scheduler.Add(std::make_unique<SpawnSystem>(&registry));
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto tick = int64_t{0}; tick < tick_count; tick++) {
+      scheduler.Update(0.0F);
+    }
+    Print("command_buffer", entity_count, threads, tick_count, stopwatch.GetSeconds(), registry.storage<gb::TestComponent>().size());
+  }
+
+  return EXIT_SUCCESS;
+}
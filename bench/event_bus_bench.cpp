@@ -0,0 +1,158 @@
+#include "bench.hpp"
+
+#include "core/components/test_component.hpp"
+#include "core/events/event_bus.hpp"
+#include "core/jobs/parallel_each.hpp"
+#include "core/jobs/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+
+#include "entt/entt.hpp"
+
+namespace {
+
+/**
+ * @brief Событие, которое система отправляет для каждой сущности.
+ */
+struct Damage {
+  entt::entity target;
+  int amount;
+};
+
+/**
+ * @brief Слушатель с виртуальным вызовом на каждое событие.
+ */
+class DamageListener {
+public:
+  virtual ~DamageListener() noexcept = default;
+
+public:
+  virtual void OnDamage(const Damage& damage) = 0;
+};
+
+class DamageCounter final : public DamageListener {
+public:
+  int64_t total{0};
+
+public:
+  void OnDamage(const Damage& damage) override {
+    total += damage.amount;
+  }
+};
+
+void Print(const char* mode, size_t entity_count, size_t threads, int64_t ticks, double seconds, int64_t total) {
+  auto events = static_cast<double>(entity_count * ticks);
+
+  gb::Bench::Report("event_bus")
+    .Add("mode", mode)
+    .Add("entities", entity_count)
+    .Add("threads", threads)
+    .Add("ns_per_event", seconds * 1e9 / events)
+    .Add("ms_per_tick", seconds * 1e3 / ticks)
+    .Add("total", total)
+    .Print();
+}
+
+} // namespace
+
+/**
+ * @brief Доставка событий: вызов слушателя на каждое событие против пачек шины событий.
+ *
+ * Каждый тик каждая сущность отправляет одно событие, слушатель суммирует урон.
+ * Режимы:
+ *   callback  - std::function на каждое событие;
+ *   virtual   - виртуальный вызов на каждое событие;
+ *   batched   - EventBus, события добавляет главный поток;
+ *   parallel  - EventBus, события добавляют потоки пула из ParallelEach.
+ *
+ * Параметры:
+ *   --entities N  Количество сущностей (по умолчанию 1000000).
+ *   --ticks N     Количество тиков (по умолчанию 50).
+ *   --threads N   Количество потоков для parallel (по умолчанию - количество ядер).
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto entity_count = static_cast<size_t>(std::max<int64_t>(1, options.GetInt("entities", 1'000'000)));
+  auto tick_count = std::max<int64_t>(1, options.GetInt("ticks", 50));
+  auto threads = static_cast<size_t>(
+    std::max<int64_t>(1, options.GetInt("threads", std::max(1U, std::thread::hardware_concurrency())))
+  );
+
+  entt::registry registry;
+  for (auto i = size_t{0}; i < entity_count; i++) {
+    registry.emplace<gb::TestComponent>(registry.create(), static_cast<int>(i % 7));
+  }
+
+  {
+    auto total = int64_t{0};
+    std::function<void(const Damage&)> callback = [&total](const Damage& damage) {
+      total += damage.amount;
+    };
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto tick = int64_t{0}; tick < tick_count; tick++) {
+      for (auto [entity, test] : registry.view<gb::TestComponent>().each()) {
+        callback(Damage{entity, test.value});
+      }
+    }
+    Print("callback", entity_count, 1, tick_count, stopwatch.GetSeconds(), total);
+  }
+
+  {
+    std::unique_ptr<DamageListener> listener = std::make_unique<DamageCounter>();
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto tick = int64_t{0}; tick < tick_count; tick++) {
+      for (auto [entity, test] : registry.view<gb::TestComponent>().each()) {
+        listener->OnDamage(Damage{entity, test.value});
+      }
+    }
+    Print("virtual", entity_count, 1, tick_count, stopwatch.GetSeconds(), static_cast<DamageCounter&>(*listener).total);
+  }
+
+  {
+    auto total = int64_t{0};
+    gb::EventBus bus(nullptr);
+    bus.Listen<Damage>([&total](std::span<const Damage> events) {
+      for (const auto& damage : events) {
+        total += damage.amount;
+      }
+    });
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto tick = int64_t{0}; tick < tick_count; tick++) {
+      for (auto [entity, test] : registry.view<gb::TestComponent>().each()) {
+        bus.Emplace<Damage>(entity, test.value);
+      }
+      bus.Dispatch();
+    }
+    Print("batched", entity_count, 1, tick_count, stopwatch.GetSeconds(), total);
+  }
+
+  {
+    auto total = int64_t{0};
+    gb::ThreadPool pool(threads - 1);
+    gb::EventBus bus(&pool);
+    bus.Listen<Damage>([&total](std::span<const Damage> events) {
+      for (const auto& damage : events) {
+        total += damage.amount;
+      }
+    });
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto tick = int64_t{0}; tick < tick_count; tick++) {
+      gb::ParallelEach<gb::TestComponent>(pool, registry, [&bus](entt::entity entity, gb::TestComponent& test) {
+        bus.Emplace<Damage>(entity, test.value);
+      });
+      bus.Dispatch();
+    }
+    Print("parallel", entity_count, threads, tick_count, stopwatch.GetSeconds(), total);
+  }
+
+  return EXIT_SUCCESS;
+}
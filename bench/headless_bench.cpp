@@ -0,0 +1,213 @@
+#include "bench.hpp"
+
+#include "core/components/test_component.hpp"
+#include "core/game.hpp"
+#include "core/input/input.hpp"
+#include "core/memory/frame_memory.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+#include "SDL.h"
+#include "SDL_hints.h"
+
+namespace {
+
+constexpr int64_t kWarmupTicks = 10; //< Тики прогрева, выделения в которых не входят в бюджет
+
+} // namespace
+
+//< Реализации данных функций находятся в src/core/game.cpp
+namespace gb {
+
+extern void OnStart(SDL_Window* window, SDL_Renderer* renderer); //< Функция начала игры
+extern void Update(float delta); //< Функция обновления логики игры с фиксированным шагом delta (сек.)
+extern void OnExit(); //< Функция завершения игры
+
+} // namespace gb
+
+/**
+ * @brief Безоконный прогон логики игры без вертикальной синхронизации и отрисовки.
+ *
+ * Параметры:
+ *   --entities N      Количество дополнительно создаваемых сущностей (по умолчанию 100000).
+ *   --ticks N         Количество тиков (по умолчанию 1000).
+ *   --report-every N  Выводить промежуточный результат каждые N тиков; для длительных прогонов.
+ *   --log PATH        Файл для логов игры (по умолчанию stderr, чтобы stdout оставался машиночитаемым).
+ *   --world PATH      Загрузить мир из снимка вместо создания сущностей; делает прогоны воспроизводимыми.
+ *   --save-world PATH Сохранить мир после создания сущностей в снимок для последующих прогонов.
+ *   --replay PATH     Воспроизвести запись ввода (guiding_breeze --record); количество тиков и, если
+ *                     не задан --world, начальный мир берутся из записи.
+ *   --alloc-budget N  Допустимое количество выделений в куче за тик после прогрева; при превышении
+ *                     прогон завершается с ошибкой (по умолчанию не проверяется). Проверяется только
+ *                     в сборке с подсчетом выделений: Debug либо GUIDING_BREEZE_COUNT_ALLOCATIONS=ON.
+ *
+ * Кроме итогового результата выводится распределение длительности тиков (headless_ticks), по
+ * которому прогоны одной записи сравниваются между сборками.
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto entity_count = options.GetInt("entities", 100'000);
+  auto tick_count = options.GetInt("ticks", 1000);
+  auto report_every = options.GetInt("report-every", 0);
+  auto log_path = options.GetString("log", "");
+  auto world_path = options.GetString("world", "");
+  auto save_world_path = options.GetString("save-world", "");
+  auto replay_path = options.GetString("replay", "");
+  auto alloc_budget = options.GetInt("alloc-budget", -1);
+
+  auto* log_output = log_path.empty() ? stderr : std::fopen(log_path.c_str(), "w");
+  gb::Logger::SetOutput(log_output ? log_output : stderr);
+
+  // Виртуальный видеодрайвер и программный отрисовщик позволяют запускать прогон без GPU и дисплея.
+  SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+  SDL_SetMainReady();
+
+  if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
+    gb::Logger::Fatal("Не удалось инициализировать SDL: {}", SDL_GetError());
+    return EXIT_FAILURE;
+  }
+
+  auto* window = SDL_CreateWindow("Guiding Breeze Bench", 0, 0, 1280, 720, SDL_WINDOW_HIDDEN);
+  if (!window) {
+    gb::Logger::Fatal("Не удалось инициализировать окно: {}", SDL_GetError());
+    SDL_Quit();
+    return EXIT_FAILURE;
+  }
+
+  auto* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+  if (!renderer) {
+    gb::Logger::Fatal("Не удалось инициализировать средство визуализации: {}", SDL_GetError());
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return EXIT_FAILURE;
+  }
+
+  gb::OnStart(window, renderer);
+
+  // Запись читается до создания мира: ее начальный мир заменяет создаваемые сущности.
+  if (!replay_path.empty()) {
+    if (!gb::Input::StartReplay(replay_path)) {
+      gb::OnExit();
+      gb::Logger::FlushAndWait();
+      SDL_DestroyRenderer(renderer);
+      SDL_DestroyWindow(window);
+      SDL_Quit();
+      return EXIT_FAILURE;
+    }
+
+    if (world_path.empty()) {
+      world_path = gb::Input::GetReplayWorld();
+    }
+  }
+
+  auto& registry = gb::Game::GetRegistry();
+  if (!world_path.empty()) {
+    if (!gb::Game::LoadWorld(world_path)) {
+      gb::OnExit();
+      gb::Logger::FlushAndWait();
+      SDL_DestroyRenderer(renderer);
+      SDL_DestroyWindow(window);
+      SDL_Quit();
+      return EXIT_FAILURE;
+    }
+  } else {
+    for (auto i = int64_t{0}; i < entity_count; i++) {
+      registry.emplace<gb::TestComponent>(registry.create(), 0);
+    }
+  }
+
+  if (!save_world_path.empty()) {
+    gb::Game::SaveWorld(save_world_path);
+  }
+
+  if (!replay_path.empty()) {
+    gb::Game::SetSeed(gb::Input::GetReplaySeed());
+    gb::Game::GetTimestep().SetTickRate(gb::Input::GetReplayTickRate());
+    tick_count = static_cast<int64_t>(gb::Input::GetReplayTickCount());
+  }
+
+  auto delta = gb::Game::GetTimestep().GetTickDuration();
+  auto total_entities = static_cast<double>(registry.storage<gb::TestComponent>().size());
+
+  auto report = [&](std::string_view bench, int64_t ticks, double seconds) {
+    gb::Bench::Report(bench)
+      .Add("entities", static_cast<int64_t>(total_entities))
+      .Add("ticks", ticks)
+      .Add("seconds", seconds)
+      .Add("ticks_per_sec", ticks / seconds)
+      .Add("ns_per_entity", seconds * 1e9 / (ticks * total_entities))
+      .Print();
+  };
+
+  std::vector<double> tick_ms(static_cast<size_t>(std::max<int64_t>(tick_count, 0)));
+  auto max_tick_allocations = uint64_t{0};
+
+  gb::Bench::Stopwatch total;
+  gb::Bench::Stopwatch window_stopwatch;
+  gb::Bench::Stopwatch tick_stopwatch;
+
+  // Каждый тик прогона - отдельный кадр для памяти кадра; первые тики прогревают арены и буферы.
+  gb::FrameMemory::BeginFrame();
+
+  for (auto tick = int64_t{1}; tick <= tick_count; tick++) {
+    tick_stopwatch.Restart();
+    gb::Update(delta);
+    tick_ms[static_cast<size_t>(tick - 1)] = tick_stopwatch.GetSeconds() * 1e3;
+    gb::Logger::Flush();
+
+    gb::FrameMemory::BeginFrame();
+    if (tick > kWarmupTicks) {
+      max_tick_allocations = std::max(max_tick_allocations, gb::FrameMemory::GetStats().heap_allocations);
+    }
+
+    if (report_every > 0 && tick % report_every == 0) {
+      report("headless_window", report_every, window_stopwatch.GetSeconds());
+      window_stopwatch.Restart();
+    }
+  }
+
+  report("headless", tick_count, total.GetSeconds());
+
+  if (!tick_ms.empty()) {
+    std::sort(tick_ms.begin(), tick_ms.end());
+    auto percentile = [&](double p) {
+      return tick_ms[static_cast<size_t>(p * (tick_ms.size() - 1))];
+    };
+
+    gb::Bench::Report("headless_ticks")
+      .Add("replay", replay_path)
+      .Add("ticks", tick_count)
+      .Add("p50_ms", percentile(0.5))
+      .Add("p90_ms", percentile(0.9))
+      .Add("p99_ms", percentile(0.99))
+      .Add("max_ms", tick_ms.back())
+      .Print();
+  }
+
+  auto counting = gb::FrameMemory::GetStats().counting;
+  auto within_budget = alloc_budget < 0 || !counting || max_tick_allocations <= static_cast<uint64_t>(alloc_budget);
+
+  gb::Bench::Report("headless_allocations")
+    .Add("counting", counting ? "true" : "false")
+    .Add("max_allocs_per_tick", counting ? static_cast<int64_t>(max_tick_allocations) : int64_t{-1})
+    .Add("budget", alloc_budget)
+    .Add("within_budget", within_budget ? "true" : "false")
+    .Print();
+
+  gb::OnExit();
+  gb::Logger::FlushAndWait();
+
+  SDL_DestroyRenderer(renderer);
+  SDL_DestroyWindow(window);
+  SDL_Quit();
+
+  gb::Logger::SetOutput(nullptr);
+  if (log_output && log_output != stderr) {
+    std::fclose(log_output);
+  }
+
+  return within_budget ? EXIT_SUCCESS : EXIT_FAILURE;
+}
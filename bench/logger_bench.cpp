@@ -0,0 +1,190 @@
+#include "bench.hpp"
+
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fmt/format.h"
+
+namespace {
+
+constexpr size_t kCalls = 200'000; //< Количество вызовов логгера в одном прогоне
+constexpr size_t kCallsPerFrame = 256; //< Количество вызовов между сбросами, имитирующее один кадр
+constexpr size_t kThroughputLines = 1'000'000; //< Количество строк в прогоне пропускной способности
+
+/**
+ * @brief Результаты одного прогона.
+ */
+struct Result {
+  double avg_ns; //< Среднее время вызова
+  double p50_ns; //< Медиана времени вызова
+  double p99_ns; //< 99-й перцентиль времени вызова
+  double max_ns; //< Максимальное время вызова
+};
+
+/**
+ * @brief Измерить время каждого вызова Logger::Info в текущем режиме логгера.
+ *
+ * @return Result Статистика задержек вызова.
+ */
+Result Run() {
+  std::vector<double> samples;
+  samples.reserve(kCalls);
+
+  for (auto i = size_t{0}; i < kCalls; i++) {
+    auto begin = std::chrono::steady_clock::now();
+    gb::Logger::Info("Сущность {} обновлена, значение {}", i, i * 3);
+    auto end = std::chrono::steady_clock::now();
+
+    samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count());
+
+    if ((i + 1) % kCallsPerFrame == 0) {
+      gb::Logger::Flush();
+    }
+  }
+
+  gb::Logger::FlushAndWait();
+
+  auto total = 0.0;
+  for (auto sample : samples) {
+    total += sample;
+  }
+
+  std::sort(samples.begin(), samples.end());
+
+  Result result;
+  result.avg_ns = total / samples.size();
+  result.p50_ns = samples[samples.size() / 2];
+  result.p99_ns = samples[samples.size() * 99 / 100];
+  result.max_ns = samples.back();
+  return result;
+}
+
+/**
+ * @brief Воспроизведение исходного синхронного пути вывода: ostringstream + put_time,
+ * копия строки уровня и fmt::println на каждую строку.
+ */
+void LegacyWriteLine(std::FILE* file, const char* message) {
+  auto now = std::chrono::system_clock::now();
+  auto time = std::chrono::system_clock::to_time_t(now);
+  auto tm = *std::localtime(&time);
+
+  std::ostringstream oss;
+  oss << std::put_time(&tm, "%H:%M:%S");
+  auto time_str = oss.str();
+
+  static const std::string kInfo = "\e[0m\033[38;2;130;130;130m[INFO]\e[0m";
+  auto level_str = kInfo;
+
+  fmt::println(file, "[{}] {} {}", time_str.c_str(), level_str.c_str(), message);
+}
+
+/**
+ * @brief Измерить пропускную способность исходного синхронного пути.
+ *
+ * @param file Файл для вывода.
+ * @return double Строк в секунду.
+ */
+double RunLegacyThroughput(std::FILE* file) {
+  auto begin = std::chrono::steady_clock::now();
+
+  for (auto i = size_t{0}; i < kThroughputLines; i++) {
+    auto msg = fmt::format("Сущность {} обновлена, значение {}", i, i * 3);
+    LegacyWriteLine(file, msg.c_str());
+  }
+
+  auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+  return kThroughputLines / seconds;
+}
+
+/**
+ * @brief Измерить пропускную способность логгера в текущем режиме, включая время записи.
+ *
+ * @return double Строк в секунду.
+ */
+double RunThroughput() {
+  auto begin = std::chrono::steady_clock::now();
+
+  for (auto i = size_t{0}; i < kThroughputLines; i++) {
+    gb::Logger::Info("Сущность {} обновлена, значение {}", i, i * 3);
+
+    if ((i + 1) % kCallsPerFrame == 0) {
+      gb::Logger::Flush();
+    }
+  }
+
+  gb::Logger::FlushAndWait();
+
+  auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+  return kThroughputLines / seconds;
+}
+
+void Print(std::string_view mode, const Result& result) {
+  gb::Bench::Report("logger_latency")
+    .Add("mode", mode)
+    .Add("calls", kCalls)
+    .Add("avg_ns", result.avg_ns)
+    .Add("p50_ns", result.p50_ns)
+    .Add("p99_ns", result.p99_ns)
+    .Add("max_ns", result.max_ns)
+    .Print();
+}
+
+void PrintThroughput(std::string_view path, double lines_per_sec) {
+  gb::Bench::Report("logger_throughput")
+    .Add("path", path)
+    .Add("lines", kThroughputLines)
+    .Add("lines_per_sec", lines_per_sec)
+    .Print();
+}
+
+} // namespace
+
+int main(int, char**) {
+  auto* null_output = std::fopen("/dev/null", "w");
+  if (!null_output) {
+    fmt::println(stderr, "Не удалось открыть /dev/null");
+    return EXIT_FAILURE;
+  }
+
+  gb::Logger::SetOutput(null_output);
+
+  gb::Logger::SetMode(gb::Logger::Mode::Sync);
+  Print("sync", Run());
+
+  gb::Logger::SetMode(gb::Logger::Mode::Async);
+  gb::Logger::SetOverflowPolicy(gb::Logger::OverflowPolicy::Block);
+  Print("async_block", Run());
+
+  auto dropped_before = gb::Logger::GetDroppedCount();
+  gb::Logger::SetOverflowPolicy(gb::Logger::OverflowPolicy::CountDropped);
+  auto count_dropped = Run();
+  gb::Bench::Report("logger_dropped")
+    .Add("mode", "async_count_dropped")
+    .Add("dropped", gb::Logger::GetDroppedCount() - dropped_before)
+    .Print();
+  Print("async_count_dropped", count_dropped);
+
+  PrintThroughput("legacy_sync", RunLegacyThroughput(null_output));
+
+  gb::Logger::SetMode(gb::Logger::Mode::Sync);
+  PrintThroughput("sync", RunThroughput());
+
+  gb::Logger::SetMode(gb::Logger::Mode::Async);
+  gb::Logger::SetOverflowPolicy(gb::Logger::OverflowPolicy::Block);
+  PrintThroughput("async_block", RunThroughput());
+
+  gb::Logger::SetOutput(nullptr);
+  std::fclose(null_output);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+#include "bench.hpp"
+
+#include "core/components/test_component.hpp"
+#include "core/jobs/parallel_each.hpp"
+#include "core/jobs/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+#include "entt/entt.hpp"
+
+namespace {
+
+constexpr size_t kIterations = 50; //< Количество проходов на одно измерение
+
+/**
+ * @brief Измерить среднее время одного прохода ParallelEach.
+ *
+ * @param pool Пул потоков.
+ * @param registry Реестр сущностей.
+ * @return double Время одного прохода в миллисекундах.
+ */
+double Run(gb::ThreadPool& pool, entt::registry& registry) {
+  // Прогревочный проход
+  gb::ParallelEach<gb::TestComponent>(pool, registry, [](gb::TestComponent& test) { test.value += 1; });
+
+  gb::Bench::Stopwatch stopwatch;
+  for (auto i = size_t{0}; i < kIterations; i++) {
+    gb::ParallelEach<gb::TestComponent>(pool, registry, [](gb::TestComponent& test) { test.value += 1; });
+  }
+
+  return stopwatch.GetSeconds() * 1000.0 / kIterations;
+}
+
+} // namespace
+
+/**
+ * @brief Масштабирование ParallelEach по количеству потоков.
+ *
+ * Параметры:
+ *   --entities N  Количество сущностей (по умолчанию 1000000).
+ *   --threads N   Максимальное количество потоков (по умолчанию - количество ядер).
+ *
+ * Затем для каждого количества потоков проверяется, что ParallelReduce дает тот же результат;
+ * при расхождении бенчмарк завершается с ошибкой.
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto entity_count = static_cast<size_t>(options.GetInt("entities", 1'000'000));
+  auto max_threads = static_cast<unsigned>(
+    std::max<int64_t>(1, options.GetInt("threads", std::max(1U, std::thread::hardware_concurrency())))
+  );
+
+  entt::registry registry;
+  for (auto i = size_t{0}; i < entity_count; i++) {
+    registry.emplace<gb::TestComponent>(registry.create(), static_cast<int>(i % 1000));
+  }
+  auto baseline = 0.0;
+
+  for (auto threads = 1U; threads <= max_threads; threads++) {
+    gb::ThreadPool pool(threads - 1);
+    auto ms = Run(pool, registry);
+
+    if (threads == 1) {
+      baseline = ms;
+    }
+
+    gb::Bench::Report("parallel_each")
+      .Add("entities", entity_count)
+      .Add("threads", threads)
+      .Add("ms_per_iter", ms)
+      .Add("ns_per_entity", ms * 1e6 / entity_count)
+      .Add("speedup", baseline / ms)
+      .Print();
+  }
+
+  // Проверка детерминированной свертки: целая сумма совпадает с последовательной, а сумма с
+  // плавающей точкой, чувствительная к порядку сложения, совпадает побитово при любом количестве потоков.
+  auto expected = int64_t{0};
+  for (auto [entity, test] : registry.view<const gb::TestComponent>().each()) {
+    expected += test.value;
+  }
+
+  auto deterministic = true;
+  auto expected_real = 0.0;
+
+  for (auto threads = 1U; threads <= max_threads; threads++) {
+    gb::ThreadPool pool(threads - 1);
+    auto sum = gb::ParallelReduce<gb::TestComponent>(
+      pool, registry, int64_t{0},
+      [](int64_t& acc, const gb::TestComponent& test) { acc += test.value; },
+      [](int64_t& target, int64_t source) { target += source; }
+    );
+    auto real_sum = gb::ParallelReduce<gb::TestComponent>(
+      pool, registry, 0.0,
+      [](double& acc, const gb::TestComponent& test) { acc += 1.0 / (test.value + 1); },
+      [](double& target, double source) { target += source; }
+    );
+
+    if (threads == 1) {
+      expected_real = real_sum;
+    }
+
+    auto matches = sum == expected && real_sum == expected_real;
+    deterministic = deterministic && matches;
+
+    gb::Bench::Report("parallel_reduce")
+      .Add("threads", threads)
+      .Add("sum", sum)
+      .Add("expected_sum", expected)
+      .Add("real_sum", real_sum)
+      .Add("matches", matches ? "true" : "false")
+      .Print();
+  }
+
+  return deterministic ? EXIT_SUCCESS : EXIT_FAILURE;
+}
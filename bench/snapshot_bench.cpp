@@ -0,0 +1,104 @@
+#include "bench.hpp"
+
+#include "core/components/test_component.hpp"
+#include "core/components/transform_component.hpp"
+#include "core/snapshot/snapshot.hpp"
+#include "logger/logger.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "entt/entt.hpp"
+
+namespace {
+
+/**
+ * @brief Прогон сохранения и загрузки с одним видом сжатия.
+ *
+ * @return true Если загруженный реестр совпадает с исходным по количеству сущностей и компонентов.
+ */
+bool Run(const entt::registry& source, const std::string& path, gb::Snapshot::Compression compression, const char* name) {
+  gb::Bench::Stopwatch stopwatch;
+  if (!gb::Snapshot::Save<gb::TestComponent, gb::TransformComponent>(source, path, compression)) {
+    return false;
+  }
+  auto save_ms = stopwatch.GetSeconds() * 1e3;
+
+  auto* file = std::fopen(path.c_str(), "rb");
+  auto bytes = int64_t{0};
+  if (file) {
+    std::fseek(file, 0, SEEK_END);
+    bytes = std::ftell(file);
+    std::fclose(file);
+  }
+
+  entt::registry target;
+  stopwatch.Restart();
+  if (!gb::Snapshot::Load<gb::TestComponent, gb::TransformComponent>(target, path)) {
+    return false;
+  }
+  auto load_ms = stopwatch.GetSeconds() * 1e3;
+
+  // У каждой живой сущности есть TestComponent, поэтому его количество равно количеству сущностей.
+  auto entities = source.view<const gb::TestComponent>().size();
+  auto matches = target.view<gb::TestComponent>().size() == entities
+    && target.view<gb::TransformComponent>().size() == source.view<const gb::TransformComponent>().size();
+
+  gb::Bench::Report("snapshot")
+    .Add("compression", name)
+    .Add("entities", static_cast<int64_t>(entities))
+    .Add("bytes", bytes)
+    .Add("bytes_per_entity", static_cast<double>(bytes) / entities)
+    .Add("save_ms", save_ms)
+    .Add("load_ms", load_ms)
+    .Add("matches", matches ? "true" : "false")
+    .Print();
+
+  return matches;
+}
+
+} // namespace
+
+/**
+ * @brief Сохранение и загрузка снимка реестра без сжатия и со сжатием.
+ *
+ * Половина сущностей имеет TransformComponent, каждая десятая уничтожается, чтобы в снимок
+ * попали разреженные хранилища и переиспользуемые идентификаторы.
+ *
+ * Параметры:
+ *   --entities N  Количество сущностей (по умолчанию 1000000).
+ *   --path PATH   Временный файл снимка (по умолчанию snapshot_bench.gbs); удаляется после прогона.
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto entity_count = options.GetInt("entities", 1'000'000);
+  auto path = options.GetString("path", "snapshot_bench.gbs");
+
+  gb::Logger::SetOutput(stderr);
+
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> position(0.0F, 10'000.0F);
+
+  entt::registry registry;
+  for (auto i = int64_t{0}; i < entity_count; i++) {
+    auto entity = registry.create();
+    registry.emplace<gb::TestComponent>(entity, static_cast<int>(i));
+    if (i % 2 == 0) {
+      registry.emplace<gb::TransformComponent>(entity, position(random), position(random));
+    }
+  }
+  for (auto i = int64_t{0}; i < entity_count; i += 10) {
+    registry.destroy(entt::entity(static_cast<entt::id_type>(i)));
+  }
+
+  auto success = Run(registry, path, gb::Snapshot::Compression::None, "none")
+    && Run(registry, path, gb::Snapshot::Compression::Lz, "lz");
+
+  std::remove(path.c_str());
+  gb::Logger::FlushAndWait();
+  gb::Logger::SetOutput(nullptr);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
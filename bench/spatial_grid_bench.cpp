@@ -0,0 +1,217 @@
+#include "bench.hpp"
+
+#include "core/components/transform_component.hpp"
+#include "core/spatial/spatial_grid.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace {
+
+constexpr float kCellSize = 128.0F;      //< Размер ячейки сетки
+constexpr float kAreaPerEntity = 400.0F; //< Площадь мира на одну сущность; плотность не зависит от количества
+constexpr float kViewWidth = 1280.0F;    //< Ширина прямоугольника запроса - размер экрана
+constexpr float kViewHeight = 720.0F;    //< Высота прямоугольника запроса
+constexpr float kRadius = 64.0F;         //< Радиус запроса соседей
+constexpr size_t kNearestCount = 8;      //< Количество ближайших соседей
+
+/**
+ * @brief Точка запроса.
+ */
+struct Point {
+  float x;
+  float y;
+};
+
+/**
+ * @brief Контрольная сумма набора сущностей, не зависящая от порядка.
+ */
+template<typename Range>
+uint64_t Checksum(const Range& entities) {
+  auto sum = uint64_t{0};
+  for (auto entity : entities) {
+    sum += entt::to_integral(entity) + 1;
+  }
+  return sum;
+}
+
+/**
+ * @brief Перебором найти сущности внутри прямоугольника.
+ */
+uint64_t BruteRange(entt::registry& registry, std::vector<entt::entity>& out, float min_x, float min_y, float max_x, float max_y) {
+  out.clear();
+  for (auto [entity, transform] : registry.view<gb::TransformComponent>().each()) {
+    if (transform.x >= min_x && transform.x <= max_x && transform.y >= min_y && transform.y <= max_y) {
+      out.push_back(entity);
+    }
+  }
+  return Checksum(out);
+}
+
+/**
+ * @brief Перебором найти сущности внутри круга.
+ */
+uint64_t BruteRadius(entt::registry& registry, std::vector<entt::entity>& out, float x, float y, float radius) {
+  out.clear();
+  for (auto [entity, transform] : registry.view<gb::TransformComponent>().each()) {
+    auto dx = transform.x - x;
+    auto dy = transform.y - y;
+    if (dx * dx + dy * dy <= radius * radius) {
+      out.push_back(entity);
+    }
+  }
+  return Checksum(out);
+}
+
+/**
+ * @brief Перебором найти ближайшие сущности.
+ */
+uint64_t BruteNearest(entt::registry& registry, std::vector<std::pair<float, entt::entity>>& heap, float x, float y, size_t count) {
+  heap.clear();
+  for (auto [entity, transform] : registry.view<gb::TransformComponent>().each()) {
+    auto dx = transform.x - x;
+    auto dy = transform.y - y;
+    auto distance = dx * dx + dy * dy;
+
+    if (heap.size() < count) {
+      heap.emplace_back(distance, entity);
+      std::push_heap(heap.begin(), heap.end());
+    } else if (distance < heap.front().first) {
+      std::pop_heap(heap.begin(), heap.end());
+      heap.back() = {distance, entity};
+      std::push_heap(heap.begin(), heap.end());
+    }
+  }
+  auto sum = uint64_t{0};
+  for (const auto& [distance, entity] : heap) {
+    sum += entt::to_integral(entity) + 1;
+  }
+  return sum;
+}
+
+/**
+ * @brief Измерить среднее время запроса в микросекундах.
+ *
+ * @param points Точки запросов.
+ * @param query Функция вида uint64_t(const Point&), возвращающая контрольную сумму найденных сущностей.
+ * @param found Сумма контрольных сумм всех запросов; совпадает у сетки и перебора.
+ */
+template<typename Query>
+double Measure(const std::vector<Point>& points, Query&& query, uint64_t& found) {
+  found = 0;
+  gb::Bench::Stopwatch stopwatch;
+  for (const auto& point : points) {
+    found += query(point);
+  }
+  return stopwatch.GetSeconds() * 1e6 / points.size();
+}
+
+/**
+ * @brief Вывести сравнение запроса к сетке с перебором.
+ */
+void Print(const char* query, size_t entities, double grid_us, double brute_us, uint64_t grid_found, uint64_t brute_found) {
+  gb::Bench::Report("spatial_grid")
+    .Add("query", query)
+    .Add("entities", entities)
+    .Add("grid_us", grid_us)
+    .Add("brute_us", brute_us)
+    .Add("speedup", brute_us / grid_us)
+    .Add("matches", grid_found == brute_found ? "true" : "false")
+    .Print();
+}
+
+/**
+ * @brief Прогон для одного количества сущностей.
+ */
+void Run(size_t entity_count, size_t query_count) {
+  std::mt19937 random(42);
+  auto world_size = std::sqrt(entity_count * kAreaPerEntity);
+  std::uniform_real_distribution<float> position(0.0F, world_size);
+  std::uniform_real_distribution<float> step(-4.0F, 4.0F);
+
+  entt::registry registry;
+  gb::SpatialGrid grid(&registry, kCellSize);
+
+  // Вставка через сигнал on_construct.
+  gb::Bench::Stopwatch stopwatch;
+  for (auto i = size_t{0}; i < entity_count; i++) {
+    registry.emplace<gb::TransformComponent>(registry.create(), position(random), position(random));
+  }
+  auto insert_ns = stopwatch.GetSeconds() * 1e9 / entity_count;
+
+  // Перемещение через сигнал on_update: все сущности сдвигаются на небольшое расстояние, как за один тик.
+  std::vector<entt::entity> entities(registry.view<gb::TransformComponent>().begin(), registry.view<gb::TransformComponent>().end());
+  stopwatch.Restart();
+  for (auto entity : entities) {
+    registry.patch<gb::TransformComponent>(entity, [&](gb::TransformComponent& transform) {
+      transform.x += step(random);
+      transform.y += step(random);
+    });
+  }
+  auto update_ns = stopwatch.GetSeconds() * 1e9 / entity_count;
+
+  gb::Bench::Report("spatial_grid_maintenance")
+    .Add("entities", entity_count)
+    .Add("cells", grid.GetCellCount())
+    .Add("insert_ns", insert_ns)
+    .Add("update_ns", update_ns)
+    .Print();
+
+  std::vector<Point> points(query_count);
+  for (auto& point : points) {
+    point = Point{position(random), position(random)};
+  }
+
+  std::vector<entt::entity> brute_out;
+  std::vector<std::pair<float, entt::entity>> brute_heap;
+  uint64_t grid_found;
+  uint64_t brute_found;
+
+  auto grid_us = Measure(points, [&](const Point& p) { return Checksum(grid.QueryRange(p.x, p.y, p.x + kViewWidth, p.y + kViewHeight)); }, grid_found);
+  auto brute_us = Measure(points, [&](const Point& p) { return BruteRange(registry, brute_out, p.x, p.y, p.x + kViewWidth, p.y + kViewHeight); }, brute_found);
+  Print("range", entity_count, grid_us, brute_us, grid_found, brute_found);
+
+  grid_us = Measure(points, [&](const Point& p) { return Checksum(grid.QueryRadius(p.x, p.y, kRadius)); }, grid_found);
+  brute_us = Measure(points, [&](const Point& p) { return BruteRadius(registry, brute_out, p.x, p.y, kRadius); }, brute_found);
+  Print("radius", entity_count, grid_us, brute_us, grid_found, brute_found);
+
+  grid_us = Measure(points, [&](const Point& p) { return Checksum(grid.QueryNearest(p.x, p.y, kNearestCount)); }, grid_found);
+  brute_us = Measure(points, [&](const Point& p) { return BruteNearest(registry, brute_heap, p.x, p.y, kNearestCount); }, brute_found);
+  Print("nearest", entity_count, grid_us, brute_us, grid_found, brute_found);
+}
+
+} // namespace
+
+/**
+ * @brief Сравнение запросов к SpatialGrid с перебором представления реестра.
+ *
+ * Параметры:
+ *   --counts N,N,...  Количества сущностей (по умолчанию 10000,100000,1000000).
+ *   --queries N       Количество запросов каждого вида (по умолчанию 200).
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto counts = options.GetString("counts", "10000,100000,1000000");
+  auto query_count = static_cast<size_t>(std::max<int64_t>(1, options.GetInt("queries", 200)));
+
+  gb::Logger::SetOutput(stderr);
+
+  for (auto begin = size_t{0}; begin < counts.size();) {
+    auto end = std::min(counts.find(',', begin), counts.size());
+    auto count = std::strtoull(counts.substr(begin, end - begin).c_str(), nullptr, 10);
+    if (count > 0) {
+      Run(static_cast<size_t>(count), query_count);
+    }
+    begin = end + 1;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+#include "bench.hpp"
+
+#include "core/components/sprite_component.hpp"
+#include "core/components/transform_component.hpp"
+#include "core/render/sprite_renderer.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "SDL.h"
+#include "entt/entt.hpp"
+
+namespace {
+
+constexpr int kWidth = 1280; //< Ширина целевой поверхности
+constexpr int kHeight = 720; //< Высота целевой поверхности
+constexpr int kLayers = 4;   //< Количество слоев спрайтов
+
+/**
+ * @brief Создать белую текстуру 8x8 для текстурированных спрайтов.
+ */
+SDL_Texture* CreateTexture(SDL_Renderer* renderer) {
+  auto* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 8, 8);
+  if (texture) {
+    std::vector<Uint32> pixels(8 * 8, 0xFFFFFFFF);
+    SDL_UpdateTexture(texture, nullptr, pixels.data(), 8 * sizeof(Uint32));
+  }
+  return texture;
+}
+
+} // namespace
+
+/**
+ * @brief Отрисовка прямоугольников программным отрисовщиком SDL: пакетная и поштучная.
+ *
+ * Параметры:
+ *   --quads N   Количество прямоугольников (по умолчанию 100000).
+ *   --frames N  Количество кадров на измерение (по умолчанию 20).
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto quad_count = options.GetInt("quads", 100'000);
+  auto frame_count = std::max<int64_t>(1, options.GetInt("frames", 20));
+
+  gb::Logger::SetOutput(stderr);
+
+  // Программный отрисовщик в поверхность не требует ни окна, ни видеодрайвера.
+  auto* surface = SDL_CreateRGBSurfaceWithFormat(0, kWidth, kHeight, 32, SDL_PIXELFORMAT_RGBA32);
+  if (!surface) {
+    gb::Logger::Fatal("Не удалось создать поверхность: {}", SDL_GetError());
+    return EXIT_FAILURE;
+  }
+
+  auto* renderer = SDL_CreateSoftwareRenderer(surface);
+  if (!renderer) {
+    gb::Logger::Fatal("Не удалось инициализировать средство визуализации: {}", SDL_GetError());
+    SDL_FreeSurface(surface);
+    return EXIT_FAILURE;
+  }
+
+  SDL_Texture* textures[] = {nullptr, CreateTexture(renderer), CreateTexture(renderer)};
+
+  // Фиксированное зерно, чтобы прогоны были сравнимы между собой.
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> x_distribution(0.0F, kWidth);
+  std::uniform_real_distribution<float> y_distribution(0.0F, kHeight);
+  std::uniform_real_distribution<float> size_distribution(4.0F, 16.0F);
+  std::uniform_int_distribution<int> byte_distribution(0, 255);
+  std::uniform_int_distribution<int> index_distribution(0, 2);
+  std::uniform_int_distribution<int> layer_distribution(0, kLayers - 1);
+
+  entt::registry registry;
+  for (auto i = int64_t{0}; i < quad_count; i++) {
+    auto entity = registry.create();
+    auto size = size_distribution(random);
+    auto color = SDL_Color{
+      static_cast<Uint8>(byte_distribution(random)), static_cast<Uint8>(byte_distribution(random)),
+      static_cast<Uint8>(byte_distribution(random)), 255
+    };
+
+    registry.emplace<gb::TransformComponent>(entity, x_distribution(random), y_distribution(random));
+    registry.emplace<gb::SpriteComponent>(
+      entity, size, size, color, textures[index_distribution(random)], SDL_FRect{0.0F, 0.0F, 1.0F, 1.0F},
+      layer_distribution(random), SDL_BLENDMODE_BLEND
+    );
+  }
+
+  // Пакетная отрисовка; первый кадр прогревает буферы.
+  gb::SpriteRenderer sprite_renderer;
+  sprite_renderer.Render(renderer, registry);
+
+  gb::Bench::Stopwatch stopwatch;
+  for (auto frame = int64_t{0}; frame < frame_count; frame++) {
+    SDL_RenderClear(renderer);
+    sprite_renderer.Render(renderer, registry);
+    SDL_RenderFlush(renderer);
+  }
+  auto batched_ms = stopwatch.GetSeconds() * 1000.0 / frame_count;
+  const auto& stats = sprite_renderer.GetStats();
+
+  gb::Bench::Report("sprite_renderer")
+    .Add("mode", "batched")
+    .Add("quads", quad_count)
+    .Add("ms_per_frame", batched_ms)
+    .Add("draw_calls", stats.draw_calls)
+    .Add("vertices", stats.vertices)
+    .Print();
+
+  // Поштучная отрисовка, как до появления пакетного отрисовщика: по вызову на прямоугольник.
+  auto view = registry.view<const gb::TransformComponent, const gb::SpriteComponent>();
+
+  stopwatch.Restart();
+  for (auto frame = int64_t{0}; frame < frame_count; frame++) {
+    SDL_RenderClear(renderer);
+    for (auto [entity, transform, sprite] : view.each()) {
+      SDL_FRect rect{transform.x, transform.y, sprite.width, sprite.height};
+      SDL_SetRenderDrawColor(renderer, sprite.color.r, sprite.color.g, sprite.color.b, sprite.color.a);
+      SDL_RenderFillRectF(renderer, &rect);
+    }
+    SDL_RenderFlush(renderer);
+  }
+  auto immediate_ms = stopwatch.GetSeconds() * 1000.0 / frame_count;
+
+  gb::Bench::Report("sprite_renderer")
+    .Add("mode", "immediate")
+    .Add("quads", quad_count)
+    .Add("ms_per_frame", immediate_ms)
+    .Add("draw_calls", quad_count)
+    .Print();
+
+  for (auto* texture : textures) {
+    if (texture) {
+      SDL_DestroyTexture(texture);
+    }
+  }
+  SDL_DestroyRenderer(renderer);
+  SDL_FreeSurface(surface);
+
+  return EXIT_SUCCESS;
+}
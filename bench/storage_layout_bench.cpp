@@ -0,0 +1,199 @@
+#include "bench.hpp"
+
+#include "core/systems/storage_layout.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace {
+
+constexpr size_t kIterations = 20; //< Количество проходов на одно измерение
+constexpr float kDelta = 1.0F / 60.0F; //< Длительность тика
+
+struct Position {
+  float x;
+  float y;
+};
+
+struct Velocity {
+  float x;
+  float y;
+};
+
+struct Health {
+  float value;
+  float regeneration;
+};
+
+/**
+ * @brief Большой компонент: горячие положение и скорость вместе с редко используемыми полями.
+ */
+struct Body {
+  Position position;
+  Velocity velocity;
+  float cold[12];
+};
+
+/**
+ * @brief Редко используемые поля Body, вынесенные при разбиении на структуру массивов.
+ */
+struct BodyCold {
+  float cold[12];
+};
+
+/**
+ * @brief Создать сущности и добавить компоненты в разном порядке, как после многих тиков
+ * создания и удаления: упакованные массивы хранилищ расходятся.
+ */
+void Populate(entt::registry& registry, size_t entity_count) {
+  std::vector<entt::entity> entities(entity_count);
+  registry.create(entities.begin(), entities.end());
+
+  std::mt19937 random(42);
+  auto shuffled = entities;
+
+  for (auto entity : entities) {
+    registry.emplace<Position>(entity, 0.0F, 0.0F);
+  }
+
+  std::shuffle(shuffled.begin(), shuffled.end(), random);
+  for (auto entity : shuffled) {
+    registry.emplace<Velocity>(entity, 1.0F, 2.0F);
+  }
+
+  std::shuffle(shuffled.begin(), shuffled.end(), random);
+  for (auto entity : shuffled) {
+    registry.emplace<Health>(entity, 100.0F, -0.5F);
+  }
+}
+
+/**
+ * @brief Измерить перебор и вывести результат.
+ *
+ * @param pass Функция одного прохода по всем сущностям.
+ */
+template<typename Pass>
+void Measure(const char* mode, size_t entity_count, Pass&& pass) {
+  // Прогревочный проход
+  pass();
+
+  gb::Bench::CacheMissCounter counter;
+  counter.Start();
+  gb::Bench::Stopwatch stopwatch;
+  for (auto i = size_t{0}; i < kIterations; i++) {
+    pass();
+  }
+  auto seconds = stopwatch.GetSeconds();
+  counter.Stop();
+
+  auto misses = counter.GetCount();
+  auto touched = static_cast<double>(entity_count * kIterations);
+
+  gb::Bench::Report("storage_layout")
+    .Add("mode", mode)
+    .Add("entities", entity_count)
+    .Add("ns_per_entity", seconds * 1e9 / touched)
+    .Add("entities_per_sec", touched / seconds)
+    .Add("cache_misses_per_entity", misses < 0 ? -1.0 : misses / touched)
+    .Print();
+}
+
+} // namespace
+
+/**
+ * @brief Перебор системы с тремя компонентами при разном расположении хранилищ.
+ *
+ * Режимы:
+ *   view     - представление по хранилищам в порядке добавления компонентов;
+ *   aligned  - то же после StorageLayout::Align по ведущему хранилищу;
+ *   group    - владеющая группа StorageLayout::Group;
+ *   aos      - один большой компонент, из которого используется четверть;
+ *   soa      - тот же компонент, разбитый на горячие компоненты в группе и холодный остаток.
+ *
+ * Промахи кэша считаются аппаратным счетчиком, если он доступен, иначе выводится -1.
+ *
+ * Параметры:
+ *   --entities N  Количество сущностей (по умолчанию 1000000).
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto entity_count = static_cast<size_t>(std::max<int64_t>(1, options.GetInt("entities", 1'000'000)));
+
+  auto integrate = [](Position& position, Velocity& velocity, Health& health) {
+    position.x += velocity.x * kDelta;
+    position.y += velocity.y * kDelta;
+    health.value += health.regeneration * kDelta;
+  };
+
+  {
+    entt::registry registry;
+    Populate(registry, entity_count);
+    Measure("view", entity_count, [&] { registry.view<Position, Velocity, Health>().each(integrate); });
+  }
+
+  {
+    entt::registry registry;
+    Populate(registry, entity_count);
+
+    gb::StorageLayout layout(&registry);
+    layout.Align<Velocity, Position>(1);
+    layout.Align<Health, Position>(1);
+    layout.Update();
+
+    Measure("aligned", entity_count, [&] { registry.view<Position, Velocity, Health>().each(integrate); });
+  }
+
+  {
+    entt::registry registry;
+    Populate(registry, entity_count);
+
+    gb::StorageLayout layout(&registry);
+    layout.Group<Position, Velocity, Health>();
+
+    Measure("group", entity_count, [&] { registry.group<Position, Velocity, Health>().each(integrate); });
+  }
+
+  {
+    entt::registry registry;
+    std::vector<entt::entity> entities(entity_count);
+    registry.create(entities.begin(), entities.end());
+    for (auto entity : entities) {
+      registry.emplace<Body>(entity, Body{{0.0F, 0.0F}, {1.0F, 2.0F}, {}});
+    }
+
+    Measure("aos", entity_count, [&] {
+      registry.view<Body>().each([](Body& body) {
+        body.position.x += body.velocity.x * kDelta;
+        body.position.y += body.velocity.y * kDelta;
+      });
+    });
+  }
+
+  {
+    entt::registry registry;
+    std::vector<entt::entity> entities(entity_count);
+    registry.create(entities.begin(), entities.end());
+
+    gb::StorageLayout layout(&registry);
+    layout.Group<Position, Velocity>();
+
+    for (auto entity : entities) {
+      registry.emplace<Position>(entity, 0.0F, 0.0F);
+      registry.emplace<Velocity>(entity, 1.0F, 2.0F);
+      registry.emplace<BodyCold>(entity);
+    }
+
+    Measure("soa", entity_count, [&] {
+      registry.group<Position, Velocity>().each([](Position& position, Velocity& velocity) {
+        position.x += velocity.x * kDelta;
+        position.y += velocity.y * kDelta;
+      });
+    });
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+#include "bench.hpp"
+
+#include "core/jobs/task.hpp"
+#include "core/jobs/task_scheduler.hpp"
+#include "core/jobs/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Работа, имитирующая шаг поиска пути или генерации.
+ */
+[[nodiscard]] int64_t Work(int64_t seed, int64_t steps) {
+  auto value = seed;
+  for (auto i = int64_t{0}; i < steps; i++) {
+    value = value * 6364136223846793005LL + 1442695040888963407LL;
+  }
+  return value & 0xFFFF;
+}
+
+gb::Task<int64_t> Job(gb::TaskScheduler& tasks, int64_t seed, int64_t steps, int64_t hops) {
+  auto result = int64_t{0};
+  for (auto hop = int64_t{0}; hop < hops; hop++) {
+    co_await tasks.Background();
+    result += Work(seed + hop, steps);
+  }
+  co_return result;
+}
+
+void Print(const char* mode, size_t threads, int64_t jobs, int64_t hops, double seconds, int64_t total) {
+  gb::Bench::Report("task_scheduler")
+    .Add("mode", mode)
+    .Add("threads", threads)
+    .Add("jobs", jobs)
+    .Add("hops", hops)
+    .Add("ns_per_hop", seconds * 1e9 / static_cast<double>(jobs * hops))
+    .Add("total", total)
+    .Print();
+}
+
+} // namespace
+
+/**
+ * @brief Накладные расходы задач-сопрограмм по сравнению с задачами пула потоков.
+ *
+ * Каждая задача выполняет несколько отрезков работы, между которыми возвращается в пул.
+ * Режимы:
+ *   pool      - каждый отрезок - отдельная задача ThreadPool;
+ *   coroutine - одна задача TaskScheduler, продолжающаяся в пуле после каждого отрезка.
+ *
+ * Параметры:
+ *   --jobs N     Количество задач (по умолчанию 10000).
+ *   --hops N     Количество отрезков работы в задаче (по умолчанию 8).
+ *   --steps N    Длина отрезка работы в итерациях (по умолчанию 1000).
+ *   --threads N  Количество потоков (по умолчанию - количество ядер).
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto jobs = std::max<int64_t>(1, options.GetInt("jobs", 10'000));
+  auto hops = std::max<int64_t>(1, options.GetInt("hops", 8));
+  auto steps = std::max<int64_t>(0, options.GetInt("steps", 1'000));
+  auto threads = static_cast<size_t>(
+    std::max<int64_t>(1, options.GetInt("threads", std::max(1U, std::thread::hardware_concurrency())))
+  );
+
+  gb::ThreadPool pool(threads - 1);
+
+  {
+    std::atomic<int64_t> total{0};
+    std::atomic<int64_t> remaining{jobs * hops};
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto job = int64_t{0}; job < jobs; job++) {
+      for (auto hop = int64_t{0}; hop < hops; hop++) {
+        pool.Submit([&total, &remaining, job, hop, steps] {
+          total.fetch_add(Work(job + hop, steps), std::memory_order_relaxed);
+          remaining.fetch_sub(1, std::memory_order_release);
+        });
+      }
+    }
+    pool.WaitUntil([&remaining] { return remaining.load(std::memory_order_acquire) == 0; });
+    Print("pool", threads, jobs, hops, stopwatch.GetSeconds(), total.load());
+  }
+
+  {
+    gb::TaskScheduler tasks(&pool);
+    std::vector<gb::TaskHandle<int64_t>> handles;
+    handles.reserve(static_cast<size_t>(jobs));
+
+    gb::Bench::Stopwatch stopwatch;
+    for (auto job = int64_t{0}; job < jobs; job++) {
+      handles.push_back(tasks.Launch(Job(tasks, job, steps, hops)));
+    }
+    pool.WaitUntil([&handles] {
+      return std::all_of(handles.begin(), handles.end(), [](const auto& handle) { return handle.IsReady(); });
+    });
+    auto seconds = stopwatch.GetSeconds();
+
+    auto total = int64_t{0};
+    for (auto& handle : handles) {
+      total += handle.Get();
+    }
+    Print("coroutine", threads, jobs, hops, seconds, total);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+#include "bench.hpp"
+
+#include "core/components/text_component.hpp"
+#include "core/components/transform_component.hpp"
+#include "core/render/font_atlas.hpp"
+#include "core/render/render_list.hpp"
+#include "core/render/text_renderer.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "entt/entt.hpp"
+#include "fmt/format.h"
+
+namespace {
+
+constexpr int kWidth = 1280; //< Ширина области вывода
+constexpr int kHeight = 720; //< Высота области вывода
+
+/**
+ * @brief Прочитать файл целиком.
+ */
+[[nodiscard]] std::vector<std::byte> ReadFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  std::vector<std::byte> bytes(data.size());
+  std::transform(data.begin(), data.end(), bytes.begin(), [](char value) { return static_cast<std::byte>(value); });
+  return bytes;
+}
+
+} // namespace
+
+/**
+ * @brief Извлечение надписей: с кэшем раскладок и с раскладкой каждой надписи в каждом кадре.
+ *
+ * Надписи - числа урона в случайных позициях; в каждом кадре у части из них меняется значение.
+ * Атлас запекается без текстуры, поэтому измеряется только работа на процессоре.
+ *
+ * Параметры:
+ *   --labels N    Количество надписей (по умолчанию 10000).
+ *   --frames N    Количество кадров на измерение (по умолчанию 100).
+ *   --changes X   Доля надписей, меняющих текст в каждом кадре (по умолчанию 0.05).
+ *   --font PATH   Файл шрифта (по умолчанию res/fonts/minecraft_seven.ttf).
+ */
+int main(int argc, char** argv) {
+  gb::Bench::Options options(argc, argv);
+  auto label_count = static_cast<size_t>(std::max<int64_t>(1, options.GetInt("labels", 10'000)));
+  auto frame_count = std::max<int64_t>(1, options.GetInt("frames", 100));
+  auto changes = std::clamp(options.GetDouble("changes", 0.05), 0.0, 1.0);
+  auto font_path = options.GetString("font", "res/fonts/minecraft_seven.ttf");
+
+  gb::Logger::SetOutput(stderr);
+
+  auto ttf = ReadFile(font_path);
+  const float sizes[] = {12.0F, 16.0F, 24.0F, 32.0F};
+
+  gb::Bench::Stopwatch bake_stopwatch;
+  auto atlas = std::make_unique<gb::FontAtlas>();
+  if (ttf.empty() || !atlas->Bake(ttf, sizes)) {
+    gb::Logger::Fatal("Не удалось запечь шрифт \"{}\".", font_path);
+    return EXIT_FAILURE;
+  }
+  auto bake_ms = bake_stopwatch.GetSeconds() * 1e3;
+
+  entt::registry registry;
+  std::mt19937 random(42);
+  std::uniform_real_distribution<float> x(0.0F, kWidth);
+  std::uniform_real_distribution<float> y(0.0F, kHeight);
+  std::uniform_int_distribution<int> damage(1, 9999);
+
+  std::vector<entt::entity> entities(label_count);
+  for (auto i = size_t{0}; i < label_count; i++) {
+    auto entity = entities[i] = registry.create();
+    registry.emplace<gb::TransformComponent>(entity, x(random), y(random));
+    registry.emplace<gb::TextComponent>(
+      entity, fmt::format("{}", damage(random)), sizes[i % std::size(sizes)], SDL_Color{255, 220, 80, 255},
+      gb::TextAlign::Center
+    );
+  }
+
+  gb::TextRenderer text_renderer;
+  text_renderer.SetAtlas(std::move(atlas));
+  gb::RenderList list;
+  auto changed_count = static_cast<size_t>(static_cast<double>(label_count) * changes);
+
+  for (auto cached : {true, false}) {
+    auto shaped = size_t{0};
+    auto seconds = 0.0;
+
+    for (auto frame = int64_t{0}; frame < frame_count; frame++) {
+      // Смена значений - работа логики, она в замер не входит.
+      for (auto i = size_t{0}; i < changed_count; i++) {
+        auto entity = entities[random() % entities.size()];
+        registry.get<gb::TextComponent>(entity).text = fmt::format("{}", damage(random));
+      }
+
+      if (!cached) {
+        text_renderer.ClearCache();
+      }
+
+      gb::Bench::Stopwatch stopwatch;
+      list.Reset(kWidth, kHeight);
+      text_renderer.Extract(registry, list);
+      seconds += stopwatch.GetSeconds();
+      shaped += text_renderer.GetStats().shaped;
+    }
+
+    const auto& stats = text_renderer.GetStats();
+    gb::Bench::Report("text_renderer")
+      .Add("mode", cached ? "cached" : "uncached")
+      .Add("labels", label_count)
+      .Add("glyphs", stats.glyphs)
+      .Add("draw_calls", list.GetCommands().size())
+      .Add("shaped_per_frame", static_cast<double>(shaped) / static_cast<double>(frame_count))
+      .Add("ms_per_frame", seconds * 1e3 / static_cast<double>(frame_count))
+      .Add("bake_ms", bake_ms)
+      .Print();
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,13 @@
+#include "spawn_system.hpp"
+#include "test_system.hpp"
+
+#include "core/plugins/plugin_api.hpp"
+
+GB_PLUGIN_EXPORT uint32_t gb_plugin_api_version() {
+  return gb::kPluginApiVersion;
+}
+
+GB_PLUGIN_EXPORT void gb_plugin_register_systems(gb::SystemRegistrar* registrar) {
+  registrar->Add<gb::TestSystem>();
+  registrar->Add<gb::SpawnSystem>();
+}
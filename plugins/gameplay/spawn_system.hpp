@@ -0,0 +1,73 @@
+#ifndef GUIDING_BREEZE_PLUGINS_GAMEPLAY_SPAWN_SYSTEM_H
+#define GUIDING_BREEZE_PLUGINS_GAMEPLAY_SPAWN_SYSTEM_H
+
+#include "core/components/sprite_component.hpp"
+#include "core/components/transform_component.hpp"
+#include "core/game.hpp"
+#include "core/input/input.hpp"
+#include "core/systems/system.hpp"
+
+#include <cstdint>
+#include <random>
+
+#include "SDL_mouse.h"
+#include "SDL_scancode.h"
+
+namespace gb {
+
+/**
+ * @brief Создание квадратов по вводу игрока.
+ *
+ * Щелчок левой кнопкой мыши создает квадрат под курсором, а удержание пробела - по квадрату
+ * за тик в случайном месте экрана. Размер и цвет выбираются генератором случайных чисел логики,
+ * поэтому записанный сеанс воспроизводится с теми же квадратами.
+ */
+class SpawnSystem final : public System {
+private:
+  static constexpr float kAreaWidth = 1280.0F; //< Ширина области случайного создания
+  static constexpr float kAreaHeight = 720.0F; //< Высота области случайного создания
+  static constexpr float kMinSize = 8.0F;      //< Наименьший размер квадрата
+  static constexpr float kMaxSize = 48.0F;     //< Наибольший размер квадрата
+
+public:
+  explicit SpawnSystem(entt::registry* registry) : System(registry) {
+    Writes<TransformComponent, SpriteComponent>();
+  }
+  ~SpawnSystem() override = default;
+
+public:
+  void Update(float) override {
+    for (const auto& event : Input::GetEvents()) {
+      if (event.type == Input::EventType::MouseButtonDown && event.code == SDL_BUTTON_LEFT) {
+        Spawn(static_cast<float>(event.x), static_cast<float>(event.y));
+      }
+    }
+
+    if (Input::IsKeyDown(SDL_SCANCODE_SPACE)) {
+      auto& random = Game::GetRandom();
+      auto x = std::uniform_real_distribution<float>(0.0F, kAreaWidth)(random);
+      auto y = std::uniform_real_distribution<float>(0.0F, kAreaHeight)(random);
+      Spawn(x, y);
+    }
+  }
+
+private:
+  void Spawn(float x, float y) {
+    auto& random = Game::GetRandom();
+    auto size = std::uniform_real_distribution<float>(kMinSize, kMaxSize)(random);
+    auto color = std::uniform_int_distribution<uint32_t>(0, 0xFFFFFF)(random);
+
+    // Квадрат центрируется на точке создания
+    auto& commands = GetCommands();
+    auto entity = commands.Create();
+    commands.Emplace<TransformComponent>(entity, x - size * 0.5F, y - size * 0.5F);
+    commands.Emplace<SpriteComponent>(
+      entity, size, size,
+      SDL_Color{static_cast<uint8_t>(color >> 16), static_cast<uint8_t>(color >> 8), static_cast<uint8_t>(color), 255}
+    );
+  }
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_PLUGINS_GAMEPLAY_SPAWN_SYSTEM_H
@@ -0,0 +1,42 @@
+#ifndef GUIDING_BREEZE_PLUGINS_GAMEPLAY_TEST_SYSTEM_H
+#define GUIDING_BREEZE_PLUGINS_GAMEPLAY_TEST_SYSTEM_H
+
+#include "logger/logger.hpp"
+
+#include "core/components/test_component.hpp"
+#include "core/systems/system.hpp"
+
+#include <atomic>
+
+namespace gb {
+
+class TestSystem final : public System {
+private:
+  std::atomic<bool> reported_{false}; //< Выведено ли значение в этом тике
+
+public:
+  explicit TestSystem(entt::registry* registry) : System(registry) {
+    Writes<TestComponent>();
+  }
+  ~TestSystem() override = default;
+
+public:
+  void Update(float) override {
+    reported_.store(false, std::memory_order_relaxed);
+
+    // Значения растут одновременно у всех сущностей, поэтому выводится одно за тик: строка на
+    // каждую сущность занимала большую часть тика на больших мирах. В релизной сборке вывода нет.
+    ParallelEach<TestComponent>([this](TestComponent& test) {
+      test.value += 1;
+
+      if (test.value % 100 == 0 && !reported_.load(std::memory_order_relaxed)
+        && !reported_.exchange(true, std::memory_order_relaxed)) {
+        Logger::Debug("{}", test.value);
+      }
+    });
+  }
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_PLUGINS_GAMEPLAY_TEST_SYSTEM_H
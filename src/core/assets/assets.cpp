@@ -0,0 +1,621 @@
+#include "assets.hpp"
+
+#include "logger/logger.hpp"
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "SDL_error.h"
+#include "SDL_pixels.h"
+#include "SDL_surface.h"
+#include "imgui.h"
+
+namespace gb::Assets {
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  constexpr auto kInvalidIndex = std::numeric_limits<uint32_t>::max(); //< Индекс недействительного дескриптора
+  constexpr auto kUploadBudget = std::chrono::milliseconds(2); //< Время на выгрузку ресурсов за кадр
+  constexpr int kAtlasPadding = 1; //< Рамка вокруг изображения атласа против просачивания соседних пикселей
+  constexpr int kAtlasClearRows = 64; //< Количество строк новой страницы атласа, очищаемых за одну выгрузку
+
+  /**
+   * @brief Страница атласа, заполняемая полками слева направо и сверху вниз.
+   */
+  struct AtlasPage {
+    SDL_Texture* texture; //< Текстура страницы
+    int shelf_x;          //< Занятая ширина текущей полки
+    int shelf_y;          //< Верхняя граница текущей полки
+    int shelf_height;     //< Высота текущей полки
+    size_t used_pixels;   //< Количество пикселей, занятых изображениями
+  };
+
+  /**
+   * @brief Запись ресурса. Используется только главным потоком.
+   */
+  struct Entry {
+    std::string path;               //< Путь к файлу
+    size_t hash{0};                 //< Хэш пути и вида ресурса
+    Kind kind{Kind::File};          //< Вид ресурса
+    State state{State::Loading};    //< Состояние ресурса
+    uint32_t generation{0};         //< Поколение записи; увеличивается при освобождении
+    uint32_t references{0};         //< Количество дескрипторов
+    TextureRegion texture{};        //< Область текстуры изображения
+    bool in_atlas{false};           //< Находится ли изображение в странице атласа
+    std::vector<std::byte> data;    //< Содержимое файла
+    size_t memory_bytes{0};         //< Занимаемая ресурсом память
+    Clock::time_point requested_at; //< Время запроса
+    double decode_ms{0.0};          //< Время чтения и декодирования в фоновом потоке, мс
+    double upload_ms{0.0};          //< Время выгрузки в текстуру, мс
+    double total_ms{0.0};           //< Время от запроса до готовности, мс
+  };
+
+  /**
+   * @brief Запрос фоновому потоку.
+   */
+  struct Request {
+    uint32_t index;      //< Индекс записи
+    uint32_t generation; //< Поколение записи
+    Kind kind;           //< Вид ресурса
+    std::string path;    //< Путь к файлу
+  };
+
+  /**
+   * @brief Результат работы фонового потока.
+   */
+  struct Result {
+    uint32_t index;              //< Индекс записи
+    uint32_t generation;         //< Поколение записи
+    SDL_Surface* surface;        //< Изображение в формате RGBA32; nullptr для файлов и при ошибке
+    std::vector<std::byte> data; //< Содержимое файла
+    bool succeeded;              //< Удалось ли загрузить ресурс
+    double decode_ms;            //< Время чтения и декодирования, мс
+  };
+
+  SDL_Renderer* renderer{nullptr}; //< Отрисовщик, в котором создаются текстуры
+  std::deque<Entry> entries; //< Записи ресурсов; deque сохраняет адреса записей при добавлении
+  std::vector<uint32_t> free_entries; //< Индексы освобожденных записей
+  std::unordered_map<size_t, uint32_t> entries_by_hash; //< Записи по хэшу пути для устранения повторов
+  std::vector<AtlasPage> atlas_pages; //< Страницы атласа
+  std::vector<uint32_t> atlas_pixels; //< Буфер изображения с рамкой перед выгрузкой в страницу атласа
+
+  std::mutex mutex; //< Мьютекс очередей запросов и результатов
+  std::condition_variable condition; //< Условная переменная для ожидания запросов фоновым потоком
+  std::deque<Request> requests; //< Очередь запросов фоновому потоку
+  std::deque<Result> results; //< Очередь результатов для главного потока
+  bool running{false}; //< Флаг работы фонового потока
+  std::thread loader; //< Фоновый поток загрузки
+
+  /**
+   * @brief Получить время в миллисекундах между двумя моментами.
+   */
+  [[nodiscard]] double GetMilliseconds(Clock::time_point begin, Clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+  }
+
+  /**
+   * @brief Прочитать файл целиком.
+   */
+  [[nodiscard]] bool ReadFile(const std::string& path, std::vector<std::byte>& data) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+      return false;
+    }
+
+    data.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())));
+  }
+
+  /**
+   * @brief Загрузить ресурс в фоновом потоке.
+   */
+  [[nodiscard]] Result Decode(const Request& request) {
+    auto begin = Clock::now();
+    auto result = Result{request.index, request.generation, nullptr, {}, false, 0.0};
+
+    if (request.kind == Kind::Texture) {
+      // Изображение сразу приводится к формату текстур, чтобы главный поток только копировал пиксели.
+      if (auto* surface = SDL_LoadBMP(request.path.c_str())) {
+        result.surface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(surface);
+      }
+      result.succeeded = result.surface != nullptr;
+    } else {
+      result.succeeded = ReadFile(request.path, result.data);
+    }
+
+    result.decode_ms = GetMilliseconds(begin, Clock::now());
+    return result;
+  }
+
+  /**
+   * @brief Цикл фонового потока загрузки.
+   */
+  void LoaderLoop() {
+    std::unique_lock lock(mutex);
+
+    while (true) {
+      condition.wait(lock, [] { return !requests.empty() || !running; });
+      if (!running) {
+        break;
+      }
+
+      auto request = std::move(requests.front());
+      requests.pop_front();
+
+      lock.unlock();
+      auto result = Decode(request);
+      lock.lock();
+
+      results.push_back(std::move(result));
+    }
+  }
+
+  /**
+   * @brief Найти место под изображение в странице атласа.
+   *
+   * @param page Страница.
+   * @param width Ширина изображения с отступом.
+   * @param height Высота изображения с отступом.
+   * @param rect Найденная область.
+   * @return true Если место найдено.
+   */
+  [[nodiscard]] bool AllocateInPage(AtlasPage& page, int width, int height, SDL_Rect& rect) {
+    if (page.shelf_x + width <= kAtlasPageSize && page.shelf_y + height <= kAtlasPageSize) {
+      rect = SDL_Rect{page.shelf_x, page.shelf_y, width, height};
+      page.shelf_x += width;
+      page.shelf_height = std::max(page.shelf_height, height);
+      return true;
+    }
+
+    // Новая полка начинается под текущей
+    auto shelf_y = page.shelf_y + page.shelf_height;
+    if (width > kAtlasPageSize || shelf_y + height > kAtlasPageSize) {
+      return false;
+    }
+
+    rect = SDL_Rect{0, shelf_y, width, height};
+    page.shelf_x = width;
+    page.shelf_y = shelf_y;
+    page.shelf_height = height;
+    return true;
+  }
+
+  /**
+   * @brief Разместить изображение в атласе, при необходимости создав новую страницу.
+   *
+   * @return AtlasPage* Страница, либо nullptr, если текстуру страницы не удалось создать.
+   */
+  [[nodiscard]] AtlasPage* AllocateInAtlas(int width, int height, SDL_Rect& rect) {
+    for (auto& page : atlas_pages) {
+      if (AllocateInPage(page, width, height, rect)) {
+        return &page;
+      }
+    }
+
+    auto* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, kAtlasPageSize, kAtlasPageSize);
+    if (!texture) {
+      Logger::Error("Не удалось создать страницу атласа: {}", SDL_GetError());
+      return nullptr;
+    }
+
+    // Содержимое новой статической текстуры не определено: страница очищается один раз, чтобы
+    // незанятые области оставались прозрачными.
+    std::vector<uint32_t> zeros(static_cast<size_t>(kAtlasPageSize) * kAtlasClearRows, 0);
+    for (auto y = 0; y < kAtlasPageSize; y += kAtlasClearRows) {
+      auto strip = SDL_Rect{0, y, kAtlasPageSize, std::min(kAtlasClearRows, kAtlasPageSize - y)};
+      SDL_UpdateTexture(texture, &strip, zeros.data(), kAtlasPageSize * static_cast<int>(sizeof(uint32_t)));
+    }
+
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    auto& page = atlas_pages.emplace_back(AtlasPage{texture, 0, 0, 0, 0});
+    return AllocateInPage(page, width, height, rect) ? &page : nullptr;
+  }
+
+  /**
+   * @brief Скопировать изображение в буфер atlas_pixels, окружив его рамкой из повторенных
+   * крайних пикселей: при фильтрации на границе изображения смешиваются только его пиксели.
+   *
+   * @param surface Изображение в формате RGBA32.
+   */
+  void ExtrudeToAtlasPixels(const SDL_Surface* surface) {
+    auto width = surface->w;
+    auto height = surface->h;
+    auto padded_width = width + kAtlasPadding * 2;
+    auto padded_height = height + kAtlasPadding * 2;
+    atlas_pixels.resize(static_cast<size_t>(padded_width) * padded_height);
+
+    for (auto y = 0; y < padded_height; y++) {
+      auto source_y = std::clamp(y - kAtlasPadding, 0, height - 1);
+      const auto* source = reinterpret_cast<const uint32_t*>(
+        static_cast<const std::byte*>(surface->pixels) + static_cast<ptrdiff_t>(source_y) * surface->pitch
+      );
+      auto* target = atlas_pixels.data() + static_cast<size_t>(y) * padded_width;
+
+      for (auto x = 0; x < padded_width; x++) {
+        target[x] = source[std::clamp(x - kAtlasPadding, 0, width - 1)];
+      }
+    }
+  }
+
+  /**
+   * @brief Выгрузить изображение в текстуру или страницу атласа.
+   */
+  [[nodiscard]] bool Upload(Entry& entry, SDL_Surface* surface) {
+    auto width = surface->w;
+    auto height = surface->h;
+
+    if (width > 0 && height > 0 && width <= kMaxAtlasImageSize && height <= kMaxAtlasImageSize) {
+      SDL_Rect rect;
+      if (auto* page = AllocateInAtlas(width + kAtlasPadding * 2, height + kAtlasPadding * 2, rect)) {
+        ExtrudeToAtlasPixels(surface);
+        SDL_UpdateTexture(page->texture, &rect, atlas_pixels.data(), rect.w * static_cast<int>(sizeof(uint32_t)));
+        page->used_pixels += static_cast<size_t>(width) * height;
+
+        // Изображение находится внутри рамки
+        constexpr auto kSize = static_cast<float>(kAtlasPageSize);
+        auto x = rect.x + kAtlasPadding;
+        auto y = rect.y + kAtlasPadding;
+        entry.texture = TextureRegion{
+          page->texture, SDL_FRect{x / kSize, y / kSize, width / kSize, height / kSize}, width, height
+        };
+        entry.in_atlas = true;
+        return true;
+      }
+    }
+
+    auto* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height);
+    if (!texture) {
+      return false;
+    }
+
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_UpdateTexture(texture, nullptr, surface->pixels, surface->pitch);
+    entry.texture = TextureRegion{texture, SDL_FRect{0.0F, 0.0F, 1.0F, 1.0F}, width, height};
+    return true;
+  }
+
+  /**
+   * @brief Принять результат фонового потока.
+   */
+  void Finish(Result& result) {
+    if (result.index >= entries.size() || entries[result.index].generation != result.generation) {
+      // Ресурс освобожден, пока загружался.
+      if (result.surface) {
+        SDL_FreeSurface(result.surface);
+      }
+      return;
+    }
+
+    auto& entry = entries[result.index];
+    entry.decode_ms = result.decode_ms;
+
+    auto begin = Clock::now();
+    if (entry.kind == Kind::Texture) {
+      result.succeeded = result.succeeded && Upload(entry, result.surface);
+      if (result.succeeded) {
+        entry.memory_bytes = static_cast<size_t>(entry.texture.width) * entry.texture.height * 4;
+      }
+      if (result.surface) {
+        SDL_FreeSurface(result.surface);
+      }
+    } else {
+      entry.data = std::move(result.data);
+      entry.memory_bytes = entry.data.capacity();
+    }
+
+    auto end = Clock::now();
+    entry.upload_ms = GetMilliseconds(begin, end);
+    entry.total_ms = GetMilliseconds(entry.requested_at, end);
+
+    if (!result.succeeded) {
+      entry.state = State::Failed;
+      Logger::Error("Не удалось загрузить ресурс \"{}\".", entry.path);
+      return;
+    }
+
+    entry.state = State::Ready;
+    Logger::Debug(
+      "Загружен ресурс \"{}\": {} байт, {:.2f} мс (чтение {:.2f} мс, выгрузка {:.2f} мс).", entry.path,
+      entry.memory_bytes, entry.total_ms, entry.decode_ms, entry.upload_ms
+    );
+  }
+
+  /**
+   * @brief Найти или создать запись ресурса и поставить запрос фоновому потоку.
+   */
+  [[nodiscard]] Handle Load(Kind kind, std::string_view path) {
+    auto hash = std::hash<std::string_view>{}(path) ^ (static_cast<size_t>(kind) + 0x9E3779B97F4A7C15ULL);
+
+    if (auto it = entries_by_hash.find(hash); it != entries_by_hash.end()) {
+      const auto& entry = entries[it->second];
+      // Совпадение хэша различных путей не должно подменять ресурс.
+      if (entry.kind == kind && entry.path == path) {
+        return Handle(it->second, entry.generation);
+      }
+    }
+
+    uint32_t index;
+    if (!free_entries.empty()) {
+      index = free_entries.back();
+      free_entries.pop_back();
+    } else {
+      index = static_cast<uint32_t>(entries.size());
+      entries.emplace_back();
+    }
+
+    auto& entry = entries[index];
+    auto generation = entry.generation;
+    entry = Entry{};
+    entry.path = path;
+    entry.hash = hash;
+    entry.kind = kind;
+    entry.generation = generation;
+    entry.requested_at = Clock::now();
+    entries_by_hash.try_emplace(hash, index);
+
+    {
+      std::lock_guard lock(mutex);
+      requests.push_back(Request{index, generation, kind, entry.path});
+    }
+    condition.notify_one();
+
+    return Handle(index, generation);
+  }
+
+  /**
+   * @brief Освободить ресурс записи, на которую больше нет дескрипторов.
+   */
+  void Release(uint32_t index) {
+    auto& entry = entries[index];
+
+    if (entry.kind == Kind::Texture && entry.state == State::Ready && !entry.in_atlas) {
+      SDL_DestroyTexture(entry.texture.texture);
+    }
+    // Область в странице атласа не переиспользуется: страницы освобождаются при Shutdown.
+
+    if (auto it = entries_by_hash.find(entry.hash); it != entries_by_hash.end() && it->second == index) {
+      entries_by_hash.erase(it);
+    }
+
+    auto generation = entry.generation + 1;
+    entry = Entry{};
+    entry.generation = generation;
+    free_entries.push_back(index);
+  }
+
+  /**
+   * @brief Получить запись по индексу и поколению.
+   *
+   * @return Entry* Запись, либо nullptr, если дескриптор устарел.
+   */
+  [[nodiscard]] Entry* FindEntry(uint32_t index, uint32_t generation) {
+    if (index >= entries.size() || entries[index].generation != generation) {
+      return nullptr;
+    }
+    return &entries[index];
+  }
+
+} // namespace
+
+Handle::Handle() : index_(kInvalidIndex), generation_(0) {}
+
+Handle::Handle(uint32_t index, uint32_t generation) : index_(index), generation_(generation) {
+  if (auto* entry = FindEntry(index_, generation_)) {
+    entry->references++;
+  } else {
+    index_ = kInvalidIndex;
+  }
+}
+
+Handle::Handle(const Handle& other) : Handle(other.index_, other.generation_) {}
+
+Handle::Handle(Handle&& other) noexcept : index_(other.index_), generation_(other.generation_) {
+  other.index_ = kInvalidIndex;
+}
+
+Handle::~Handle() noexcept {
+  Reset();
+}
+
+Handle& Handle::operator=(const Handle& other) {
+  if (this != &other) {
+    *this = Handle(other);
+  }
+  return *this;
+}
+
+Handle& Handle::operator=(Handle&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    index_ = std::exchange(other.index_, kInvalidIndex);
+    generation_ = other.generation_;
+  }
+  return *this;
+}
+
+bool Handle::IsValid() const {
+  return FindEntry(index_, generation_) != nullptr;
+}
+
+State Handle::GetState() const {
+  const auto* entry = FindEntry(index_, generation_);
+  return entry ? entry->state : State::Failed;
+}
+
+const TextureRegion* Handle::GetTexture() const {
+  const auto* entry = FindEntry(index_, generation_);
+  return entry && entry->kind == Kind::Texture && entry->state == State::Ready ? &entry->texture : nullptr;
+}
+
+const std::vector<std::byte>* Handle::GetData() const {
+  const auto* entry = FindEntry(index_, generation_);
+  return entry && entry->kind == Kind::File && entry->state == State::Ready ? &entry->data : nullptr;
+}
+
+void Handle::Reset() {
+  if (auto* entry = FindEntry(index_, generation_)) {
+    if (--entry->references == 0) {
+      Release(index_);
+    }
+  }
+  index_ = kInvalidIndex;
+}
+
+void Initialize(SDL_Renderer* renderer) {
+  Assets::renderer = renderer;
+
+  {
+    std::lock_guard lock(mutex);
+    running = true;
+  }
+  loader = std::thread(LoaderLoop);
+}
+
+void Shutdown() {
+  {
+    std::lock_guard lock(mutex);
+    running = false;
+    requests.clear();
+  }
+  condition.notify_all();
+
+  if (loader.joinable()) {
+    loader.join();
+  }
+
+  for (auto& result : results) {
+    if (result.surface) {
+      SDL_FreeSurface(result.surface);
+    }
+  }
+  results.clear();
+
+  for (auto& entry : entries) {
+    if (entry.kind == Kind::Texture && entry.state == State::Ready && !entry.in_atlas) {
+      SDL_DestroyTexture(entry.texture.texture);
+    }
+  }
+  for (auto& page : atlas_pages) {
+    SDL_DestroyTexture(page.texture);
+  }
+
+  // Оставшиеся дескрипторы становятся недействительными.
+  entries.clear();
+  free_entries.clear();
+  entries_by_hash.clear();
+  atlas_pages.clear();
+  atlas_pixels = {};
+  renderer = nullptr;
+}
+
+Handle LoadTexture(std::string_view path) {
+  return Load(Kind::Texture, path);
+}
+
+Handle LoadFile(std::string_view path) {
+  return Load(Kind::File, path);
+}
+
+void Update() {
+  GB_PROFILE_ZONE("Ресурсы");
+
+  auto begin = Clock::now();
+
+  while (Clock::now() - begin < kUploadBudget) {
+    Result result;
+    {
+      std::lock_guard lock(mutex);
+      if (results.empty()) {
+        break;
+      }
+      result = std::move(results.front());
+      results.pop_front();
+    }
+
+    Finish(result);
+  }
+}
+
+void DrawWindow() {
+  if (!ImGui::Begin("Ресурсы")) {
+    ImGui::End();
+    return;
+  }
+
+  auto total_bytes = size_t{0};
+  auto loading = size_t{0};
+  for (const auto& entry : entries) {
+    total_bytes += entry.memory_bytes;
+    loading += entry.references > 0 && entry.state == State::Loading ? 1 : 0;
+  }
+
+  auto atlas_pixels = size_t{0};
+  for (const auto& page : atlas_pages) {
+    atlas_pixels += page.used_pixels;
+  }
+  auto atlas_capacity = atlas_pages.size() * kAtlasPageSize * kAtlasPageSize;
+
+  ImGui::Text("Ресурсов: %zu, загружается: %zu", entries.size() - free_entries.size(), loading);
+  ImGui::Text("Память ресурсов: %.2f МБ", total_bytes / (1024.0 * 1024.0));
+  ImGui::Text(
+    "Страниц атласа: %zu (%.2f МБ), заполнено %.1f%%", atlas_pages.size(), atlas_capacity * 4 / (1024.0 * 1024.0),
+    atlas_capacity > 0 ? 100.0 * atlas_pixels / atlas_capacity : 0.0
+  );
+
+  constexpr auto kTableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+  if (ImGui::BeginTable("##assets", 6, kTableFlags, ImVec2(0.0F, 240.0F))) {
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Путь");
+    ImGui::TableSetupColumn("Состояние");
+    ImGui::TableSetupColumn("Ссылок");
+    ImGui::TableSetupColumn("Память, КБ");
+    ImGui::TableSetupColumn("Чтение, мс");
+    ImGui::TableSetupColumn("Всего, мс");
+    ImGui::TableHeadersRow();
+
+    static const char* states[] = {"Загрузка", "Готов", "Ошибка"};
+    for (const auto& entry : entries) {
+      if (entry.references == 0) {
+        continue;
+      }
+
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(entry.path.c_str());
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(states[static_cast<size_t>(entry.state)]);
+      ImGui::TableNextColumn();
+      ImGui::Text("%u", entry.references);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", entry.memory_bytes / 1024.0);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.2f", entry.decode_ms);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.2f", entry.total_ms);
+    }
+
+    ImGui::EndTable();
+  }
+
+  ImGui::End();
+}
+
+} // namespace gb::Assets
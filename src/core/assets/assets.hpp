@@ -0,0 +1,158 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_ASSETS_ASSETS_H
+#define GUIDING_BREEZE_SRC_CORE_ASSETS_ASSETS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <sys/types.h>
+#include <vector>
+
+#include "SDL_rect.h"
+#include "SDL_render.h"
+
+namespace gb::Assets {
+
+constexpr int kAtlasPageSize = 1024;    //< Размер стороны страницы атласа в пикселях
+constexpr int kMaxAtlasImageSize = 128; //< Наибольшая сторона изображения, упаковываемого в атлас
+
+/**
+ * @brief Вид ресурса.
+ */
+enum class Kind : u_short {
+  Texture, //< Изображение, загружаемое в текстуру или атлас
+  File     //< Содержимое файла без обработки
+};
+
+/**
+ * @brief Состояние ресурса.
+ */
+enum class State : u_short {
+  Loading, //< Ресурс читается фоновым потоком или ожидает выгрузки в текстуру
+  Ready,   //< Ресурс готов к использованию
+  Failed   //< Ресурс не удалось загрузить
+};
+
+/**
+ * @brief Область текстуры, занимаемая изображением.
+ */
+struct TextureRegion {
+  SDL_Texture* texture; //< Текстура; для мелких изображений - общая страница атласа
+  SDL_FRect uv;         //< Область изображения в нормализованных координатах текстуры
+  int width;            //< Ширина изображения в пикселях
+  int height;           //< Высота изображения в пикселях
+};
+
+/**
+ * @brief Дескриптор ресурса с подсчетом ссылок.
+ *
+ * Ресурс освобождается, когда уничтожается последний ссылающийся на него дескриптор.
+ *
+ * @note Дескрипторы используются только в главном потоке.
+ */
+class Handle final {
+private:
+  uint32_t index_;      //< Индекс записи ресурса
+  uint32_t generation_; //< Поколение записи; защищает от обращения к переиспользованной записи
+
+public:
+  Handle();
+
+  /**
+   * @brief Создать дескриптор записи ресурса и увеличить счетчик ее ссылок.
+   *
+   * @param index Индекс записи.
+   * @param generation Поколение записи.
+   */
+  Handle(uint32_t index, uint32_t generation);
+  Handle(const Handle& other);
+  Handle(Handle&& other) noexcept;
+  ~Handle() noexcept;
+
+public:
+  Handle& operator=(const Handle& other);
+  Handle& operator=(Handle&& other) noexcept;
+
+public:
+  /**
+   * @brief Проверить, ссылается ли дескриптор на существующий ресурс.
+   */
+  [[nodiscard]] bool IsValid() const;
+
+  /**
+   * @brief Получить состояние ресурса.
+   *
+   * @return State Состояние; State::Failed для недействительного дескриптора.
+   */
+  [[nodiscard]] State GetState() const;
+
+  /**
+   * @brief Получить область текстуры изображения.
+   *
+   * @return const TextureRegion* Область, либо nullptr, если изображение еще не готово.
+   */
+  [[nodiscard]] const TextureRegion* GetTexture() const;
+
+  /**
+   * @brief Получить содержимое файла.
+   *
+   * @return const std::vector<std::byte>* Содержимое, либо nullptr, если файл еще не прочитан.
+   */
+  [[nodiscard]] const std::vector<std::byte>* GetData() const;
+
+  /**
+   * @brief Отпустить ресурс, сделав дескриптор недействительным.
+   */
+  void Reset();
+};
+
+/**
+ * @brief Запустить фоновый поток загрузки.
+ *
+ * @param renderer Отрисовщик, в котором создаются текстуры.
+ */
+void Initialize(SDL_Renderer* renderer);
+
+/**
+ * @brief Остановить фоновый поток и освободить все ресурсы.
+ *
+ * @note Вызывается до уничтожения отрисовщика.
+ */
+void Shutdown();
+
+/**
+ * @brief Запросить загрузку изображения BMP.
+ *
+ * Изображения не больше kMaxAtlasImageSize по обеим сторонам упаковываются в общие
+ * страницы атласа, остальные получают собственную текстуру. Повторный запрос того же
+ * пути возвращает дескриптор уже загруженного ресурса.
+ *
+ * @param path Путь к файлу.
+ * @return Handle Дескриптор; ресурс становится готов в одном из следующих вызовов Update.
+ */
+[[nodiscard]] Handle LoadTexture(std::string_view path);
+
+/**
+ * @brief Запросить чтение файла целиком.
+ *
+ * @param path Путь к файлу.
+ * @return Handle Дескриптор; ресурс становится готов в одном из следующих вызовов Update.
+ */
+[[nodiscard]] Handle LoadFile(std::string_view path);
+
+/**
+ * @brief Принять загруженные фоновым потоком ресурсы и выгрузить изображения в текстуры.
+ *
+ * Выгрузка ограничена по времени, чтобы поток ресурсов не задерживал кадры.
+ *
+ * @note Вызывается из потока отрисовки каждый кадр до ImGui::NewFrame.
+ */
+void Update();
+
+/**
+ * @brief Отрисовать окно ImGui со списком ресурсов, временем их загрузки и потреблением памяти.
+ */
+void DrawWindow();
+
+} // namespace gb::Assets
+
+#endif // GUIDING_BREEZE_SRC_CORE_ASSETS_ASSETS_H
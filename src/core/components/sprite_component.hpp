@@ -0,0 +1,28 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_COMPONENTS_SPRITE_COMPONENT_H
+#define GUIDING_BREEZE_SRC_CORE_COMPONENTS_SPRITE_COMPONENT_H
+
+#include <cstdint>
+
+#include "SDL_blendmode.h"
+#include "SDL_pixels.h"
+#include "SDL_rect.h"
+#include "SDL_render.h"
+
+namespace gb {
+
+/**
+ * @brief Прямоугольный спрайт, отрисовываемый в позиции TransformComponent.
+ */
+struct SpriteComponent {
+  float width;                                   //< Ширина в пикселях
+  float height;                                  //< Высота в пикселях
+  SDL_Color color{255, 255, 255, 255};           //< Цвет, умножаемый на текстуру
+  SDL_Texture* texture{nullptr};                 //< Текстура; nullptr - сплошная заливка цветом
+  SDL_FRect uv{0.0F, 0.0F, 1.0F, 1.0F};          //< Область текстуры в нормализованных координатах
+  int32_t layer{0};                              //< Слой; спрайты с большим слоем рисуются поверх
+  SDL_BlendMode blend_mode{SDL_BLENDMODE_BLEND}; //< Режим смешивания
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_COMPONENTS_SPRITE_COMPONENT_H
@@ -0,0 +1,36 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_COMPONENTS_TEXT_COMPONENT_H
+#define GUIDING_BREEZE_SRC_CORE_COMPONENTS_TEXT_COMPONENT_H
+
+#include <sys/types.h>
+
+#include <string>
+
+#include "SDL_pixels.h"
+
+namespace gb {
+
+/**
+ * @brief Выравнивание текста относительно его позиции.
+ */
+enum class TextAlign : u_short {
+  Left,   //< Позиция - левый край
+  Center, //< Позиция - середина
+  Right,  //< Позиция - правый край
+};
+
+/**
+ * @brief Надпись, отрисовываемая в позиции TransformComponent поверх спрайтов.
+ *
+ * @note Раскладка надписи кэшируется по ее тексту и размеру, поэтому неизменная надпись
+ * не раскладывается заново; текст стоит менять только при изменении значения.
+ */
+struct TextComponent {
+  std::string text;                    //< Текст в UTF-8; перевод строки начинает новую строку
+  float size{16.0F};                   //< Размер в пикселях; используется ближайший запеченный
+  SDL_Color color{255, 255, 255, 255}; //< Цвет текста
+  TextAlign align{TextAlign::Left};    //< Выравнивание по горизонтали
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_COMPONENTS_TEXT_COMPONENT_H
@@ -0,0 +1,16 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_COMPONENTS_TRANSFORM_COMPONENT_H
+#define GUIDING_BREEZE_SRC_CORE_COMPONENTS_TRANSFORM_COMPONENT_H
+
+namespace gb {
+
+/**
+ * @brief Положение сущности в мире.
+ */
+struct TransformComponent {
+  float x; //< Координата X левого верхнего угла в пикселях
+  float y; //< Координата Y левого верхнего угла в пикселях
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_COMPONENTS_TRANSFORM_COMPONENT_H
@@ -0,0 +1,40 @@
+#include "event_bus.hpp"
+
+#include "profiler/profiler.hpp"
+
+#include <atomic>
+
+namespace gb {
+
+EventBus::EventBus(ThreadPool* pool)
+  : pool_(pool),
+    slot_count_(pool ? pool->GetWorkerCount() + 1 : 1) {
+}
+
+size_t EventBus::Dispatch() {
+  GB_PROFILE_ZONE("Доставка событий");
+
+  // Слушатель может зарегистрировать новый тип, поэтому перебор идет по индексам.
+  auto count = size_t{0};
+  for (auto i = size_t{0}; i < order_.size(); i++) {
+    count += queues_[order_[i]]->Dispatch();
+  }
+  return count;
+}
+
+void EventBus::Clear() {
+  for (auto index : order_) {
+    queues_[index]->Clear();
+  }
+}
+
+size_t EventBus::NextTypeIndex() {
+  static std::atomic<size_t> next{0};
+  return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t EventBus::GetSlot() const {
+  return pool_ ? pool_->GetCurrentWorkerIndex() : 0;
+}
+
+} // namespace gb
@@ -0,0 +1,221 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_EVENTS_EVENT_BUS_H
+#define GUIDING_BREEZE_SRC_CORE_EVENTS_EVENT_BUS_H
+
+#include "core/jobs/thread_pool.hpp"
+
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace gb {
+
+/**
+ * @brief Шина событий с очередями по типам.
+ *
+ * События каждого типа копятся в непрерывных массивах и доставляются слушателям пачкой
+ * в Dispatch, а не по одному: слушатель вызывается один раз на тип за точку доставки
+ * и перебирает события подряд.
+ *
+ * У каждого потока пула и у главного потока свой массив на тип, поэтому добавлять события
+ * из функций ParallelEach можно без блокировок. При доставке массивы потоков склеиваются
+ * по порядку индексов потоков, и порядок событий внутри одного потока сохраняется.
+ *
+ * @note Типы событий регистрируются из главного потока до того, как события начнут
+ * добавляться из рабочих потоков. Добавлять события могут только главный поток и потоки пула.
+ */
+class EventBus final {
+public:
+  /**
+   * @brief Слушатель событий одного типа.
+   */
+  template<typename Event>
+  using Listener = std::function<void(std::span<const Event>)>;
+
+private:
+  /**
+   * @brief Очередь событий одного типа.
+   */
+  class QueueBase {
+  public:
+    virtual ~QueueBase() noexcept = default;
+
+  public:
+    virtual size_t Dispatch() = 0;
+    virtual void Clear() = 0;
+  };
+
+  template<typename Event>
+  class Queue final : public QueueBase {
+  private:
+    /**
+     * @brief События, добавленные одним потоком; выровнены, чтобы потоки не делили строку кэша.
+     */
+    struct alignas(64) Slot {
+      std::vector<Event> events;
+    };
+
+  private:
+    std::vector<Slot> slots_;                 //< События по потокам
+    std::vector<Event> batch_;                //< Доставляемая пачка
+    std::vector<Listener<Event>> listeners_;  //< Слушатели в порядке подписки
+
+  public:
+    explicit Queue(size_t slot_count) : slots_(slot_count) {
+    }
+
+  public:
+    void Push(size_t slot, Event&& event) {
+      slots_[slot].events.push_back(std::move(event));
+    }
+
+    void Listen(Listener<Event>&& listener) {
+      listeners_.push_back(std::move(listener));
+    }
+
+    size_t Dispatch() override {
+      // Чаще всего события добавил один поток: его массив забирается целиком, без копирования.
+      for (auto& slot : slots_) {
+        if (slot.events.empty()) {
+          continue;
+        }
+
+        if (batch_.empty()) {
+          std::swap(batch_, slot.events);
+        } else {
+          batch_.insert(batch_.end(), std::make_move_iterator(slot.events.begin()), std::make_move_iterator(slot.events.end()));
+          slot.events.clear();
+        }
+      }
+
+      auto count = batch_.size();
+      if (count > 0) {
+        for (auto& listener : listeners_) {
+          listener(std::span<const Event>(batch_));
+        }
+        batch_.clear();
+      }
+
+      return count;
+    }
+
+    void Clear() override {
+      for (auto& slot : slots_) {
+        slot.events.clear();
+      }
+    }
+  };
+
+private:
+  ThreadPool* pool_;                                //< Пул, по индексам потоков которого выбираются массивы
+  size_t slot_count_;                               //< Количество массивов на тип
+  std::vector<std::unique_ptr<QueueBase>> queues_;  //< Очереди по индексу типа; пустые для незарегистрированных
+  std::vector<size_t> order_;                       //< Индексы типов в порядке регистрации
+
+public:
+  /**
+   * @param pool Пул потоков, из задач которого добавляются события; nullptr - только главный поток.
+   */
+  explicit EventBus(ThreadPool* pool);
+  EventBus(const EventBus&) = delete;
+  EventBus(EventBus&&) = delete;
+  ~EventBus() noexcept = default;
+
+public:
+  EventBus& operator=(const EventBus&) = delete;
+  EventBus& operator=(EventBus&&) = delete;
+
+public:
+  /**
+   * @brief Зарегистрировать тип событий.
+   *
+   * @note Повторная регистрация ничего не делает. Типы доставляются в порядке регистрации.
+   */
+  template<typename Event>
+  void Register() {
+    auto index = GetTypeIndex<Event>();
+    if (index >= queues_.size()) {
+      queues_.resize(index + 1);
+    }
+
+    if (!queues_[index]) {
+      queues_[index] = std::make_unique<Queue<Event>>(slot_count_);
+      order_.push_back(index);
+    }
+  }
+
+  /**
+   * @brief Подписаться на события типа; тип регистрируется, если еще не зарегистрирован.
+   *
+   * @param listener Функция вида void(std::span<const Event>); вызывается в Dispatch из главного потока.
+   * @note Не вызывается из слушателей во время доставки.
+   */
+  template<typename Event, typename Func>
+  void Listen(Func&& listener) {
+    Register<Event>();
+    GetQueue<Event>().Listen(Listener<Event>(std::forward<Func>(listener)));
+  }
+
+  /**
+   * @brief Добавить событие в очередь вызывающего потока.
+   *
+   * @note Событие, добавленное слушателем во время доставки, доставляется в следующей точке.
+   */
+  template<typename Event>
+  void Enqueue(Event event) {
+    GetQueue<Event>().Push(GetSlot(), std::move(event));
+  }
+
+  /**
+   * @brief Создать событие на месте в очереди вызывающего потока.
+   */
+  template<typename Event, typename... Args>
+  void Emplace(Args&&... args) {
+    GetQueue<Event>().Push(GetSlot(), Event{std::forward<Args>(args)...});
+  }
+
+  /**
+   * @brief Доставить накопленные события всех типов слушателям.
+   *
+   * @return size_t Количество доставленных событий.
+   * @note Вызывается из главного потока в точке синхронизации, когда рабочие потоки не добавляют события.
+   */
+  size_t Dispatch();
+
+  /**
+   * @brief Доставить накопленные события одного типа.
+   */
+  template<typename Event>
+  size_t Dispatch() {
+    return GetQueue<Event>().Dispatch();
+  }
+
+  /**
+   * @brief Отбросить все накопленные события, не доставляя их.
+   */
+  void Clear();
+
+private:
+  [[nodiscard]] static size_t NextTypeIndex();
+
+  template<typename Event>
+  [[nodiscard]] static size_t GetTypeIndex() {
+    static const auto index = NextTypeIndex();
+    return index;
+  }
+
+  template<typename Event>
+  [[nodiscard]] Queue<Event>& GetQueue() {
+    auto index = GetTypeIndex<Event>();
+    assert(index < queues_.size() && queues_[index] && "Тип событий не зарегистрирован");
+    return static_cast<Queue<Event>&>(*queues_[index]);
+  }
+
+  [[nodiscard]] size_t GetSlot() const;
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_EVENTS_EVENT_BUS_H
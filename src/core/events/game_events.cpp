@@ -0,0 +1,50 @@
+#include "game_events.hpp"
+
+namespace gb::Events {
+
+void Register(EventBus& bus) {
+  bus.Register<Quit>();
+  bus.Register<WindowResized>();
+  bus.Register<WindowMoved>();
+  bus.Register<WindowDisplayChanged>();
+  bus.Register<WindowFocusChanged>();
+  bus.Register<DisplaysChanged>();
+}
+
+void Translate(EventBus& bus, const SDL_Event& event) {
+  switch (event.type) {
+    case SDL_QUIT:
+      bus.Emplace<Quit>();
+      break;
+    case SDL_DISPLAYEVENT:
+      bus.Emplace<DisplaysChanged>(static_cast<int>(event.display.display));
+      break;
+    case SDL_WINDOWEVENT:
+      {
+        switch (event.window.event) {
+          case SDL_WINDOWEVENT_SIZE_CHANGED:
+            bus.Emplace<WindowResized>(event.window.data1, event.window.data2);
+            break;
+          case SDL_WINDOWEVENT_MOVED:
+            bus.Emplace<WindowMoved>(event.window.data1, event.window.data2);
+            break;
+          case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+            bus.Emplace<WindowDisplayChanged>(event.window.data1);
+            break;
+          case SDL_WINDOWEVENT_FOCUS_GAINED:
+            bus.Emplace<WindowFocusChanged>(true);
+            break;
+          case SDL_WINDOWEVENT_FOCUS_LOST:
+            bus.Emplace<WindowFocusChanged>(false);
+            break;
+          default:
+            break;
+        }
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+} // namespace gb::Events
@@ -0,0 +1,72 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_EVENTS_GAME_EVENTS_H
+#define GUIDING_BREEZE_SRC_CORE_EVENTS_GAME_EVENTS_H
+
+#include "core/events/event_bus.hpp"
+
+#include "SDL_events.h"
+
+/**
+ * @brief События игры, в которые один раз переводятся события SDL из цикла опроса.
+ *
+ * Ввод с клавиатуры и мыши сюда не входит: он проходит через gb::Input, чтобы записываться
+ * и воспроизводиться.
+ */
+namespace gb::Events {
+
+/**
+ * @brief Запрошено завершение игры.
+ */
+struct Quit {};
+
+/**
+ * @brief Изменился размер окна.
+ */
+struct WindowResized {
+  int width;  //< Ширина окна в пикселях
+  int height; //< Высота окна в пикселях
+};
+
+/**
+ * @brief Окно перемещено.
+ */
+struct WindowMoved {
+  int x; //< Положение окна по горизонтали
+  int y; //< Положение окна по вертикали
+};
+
+/**
+ * @brief Окно перешло на другой дисплей.
+ */
+struct WindowDisplayChanged {
+  int display_index; //< Индекс нового дисплея
+};
+
+/**
+ * @brief Окно получило или потеряло фокус.
+ */
+struct WindowFocusChanged {
+  bool focused; //< Есть ли у окна фокус
+};
+
+/**
+ * @brief Дисплей подключен, отключен или повернут.
+ */
+struct DisplaysChanged {
+  int display_index; //< Индекс дисплея
+};
+
+/**
+ * @brief Зарегистрировать все события игры в шине.
+ */
+void Register(EventBus& bus);
+
+/**
+ * @brief Перевести событие SDL в событие игры и добавить его в шину.
+ *
+ * @note События, не имеющие соответствия, пропускаются.
+ */
+void Translate(EventBus& bus, const SDL_Event& event);
+
+} // namespace gb::Events
+
+#endif // GUIDING_BREEZE_SRC_CORE_EVENTS_GAME_EVENTS_H
@@ -0,0 +1,242 @@
+#include "frame_pacer.hpp"
+
+#include "core/events/game_events.hpp"
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "SDL_timer.h"
+#include "SDL_video.h"
+
+namespace gb {
+
+namespace {
+
+  constexpr uint32_t kDefaultRefreshRate = 60; //< Частота обновления, если дисплей ее не сообщает
+  constexpr uint64_t kSpinMarginMs = 2; //< Последние миллисекунды ожидания проводятся в активном ожидании
+  constexpr double kMissedFrameFactor = 1.5; //< Кадр длиннее стольких периодов обновления пропустил синхронизацию
+  constexpr double kOnTimeFrameFactor = 0.9; //< Кадр короче стольких периодов обновления успевает к синхронизации
+  constexpr uint32_t kRecoverFrames = 120; //< Кадров подряд, успевших к сроку, для возврата синхронизации
+
+} // namespace
+
+void FramePacer::Accumulator::Add(double value) {
+  count++;
+  auto delta = value - mean;
+  mean += delta / count;
+  m2 += delta * (value - mean);
+  max = std::max(max, value);
+}
+
+FramePacer::FramePacer()
+  : counter_frequency_(SDL_GetPerformanceFrequency()) {
+}
+
+void FramePacer::SetRenderer(SDL_Renderer* renderer) {
+  renderer_ = renderer;
+  SetMode(mode_);
+  Restart();
+}
+
+void FramePacer::SetMode(PacingMode mode) {
+  mode_ = mode;
+  on_time_frames_ = 0;
+  skip_sample_ = true;
+  SetVSync(mode == PacingMode::VSync || mode == PacingMode::Adaptive);
+}
+
+PacingMode FramePacer::GetMode() const {
+  return mode_;
+}
+
+void FramePacer::SetTargetRate(uint32_t target_rate) {
+  target_rate_ = target_rate;
+}
+
+uint32_t FramePacer::GetTargetRate() const {
+  return target_rate_;
+}
+
+uint32_t FramePacer::GetRefreshRate() const {
+  return refresh_rate_;
+}
+
+bool FramePacer::IsVSyncEnabled() const {
+  return vsync_;
+}
+
+void FramePacer::HandleEvent(const SDL_Event& event) {
+  switch (event.type) {
+    case SDL_KEYDOWN:
+    case SDL_KEYUP:
+    case SDL_MOUSEMOTION:
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+    case SDL_MOUSEWHEEL:
+      if (!has_input_ || event.common.timestamp < earliest_input_ms_) {
+        earliest_input_ms_ = event.common.timestamp;
+      }
+      has_input_ = true;
+      break;
+    default:
+      break;
+  }
+}
+
+void FramePacer::EndFrame() {
+  auto skip = skip_sample_;
+  skip_sample_ = false;
+
+  // Задержка ввода измеряется до завершения вывода, без ожидания ограничения частоты.
+  if (has_input_) {
+    has_input_ = false;
+    if (!skip) {
+      input_latencies_[static_cast<size_t>(mode_)].Add(static_cast<double>(SDL_GetTicks() - earliest_input_ms_));
+    }
+  }
+
+  auto now = SDL_GetPerformanceCounter();
+
+  if (mode_ == PacingMode::Capped) {
+    auto period = GetPeriod(target_rate_ > 0 ? target_rate_ : refresh_rate_);
+    next_deadline_ += period;
+
+    // Сроки отсчитываются от прошлого срока, а не от конца кадра, чтобы ошибка ожидания не накапливалась.
+    // Сильно опоздавший кадр начинает отсчет заново, иначе следующие кадры догоняли бы его без ожидания.
+    if (skip || next_deadline_ + period < now) {
+      next_deadline_ = now;
+    } else {
+      WaitUntil(next_deadline_);
+      now = SDL_GetPerformanceCounter();
+    }
+  }
+
+  auto frame_ms = (now - last_frame_end_) * 1000.0 / counter_frequency_;
+  last_frame_end_ = now;
+
+  if (skip) {
+    return;
+  }
+
+  frame_times_[static_cast<size_t>(mode_)].Add(frame_ms);
+
+  // Пропустивший синхронизацию кадр ждал бы следующую целый период; вместо этого синхронизация
+  // отключается, пока кадры снова не станут стабильно успевать к ней.
+  if (mode_ == PacingMode::Adaptive) {
+    auto refresh_ms = 1000.0 / refresh_rate_;
+
+    if (vsync_) {
+      if (frame_ms > refresh_ms * kMissedFrameFactor) {
+        SetVSync(false);
+        on_time_frames_ = 0;
+      }
+    } else if (frame_ms < refresh_ms * kOnTimeFrameFactor) {
+      if (++on_time_frames_ >= kRecoverFrames) {
+        SetVSync(true);
+      }
+    } else {
+      on_time_frames_ = 0;
+    }
+  }
+}
+
+void FramePacer::Restart() {
+  refresh_rate_ = kDefaultRefreshRate;
+
+  if (renderer_) {
+    auto display_index = SDL_GetWindowDisplayIndex(SDL_RenderGetWindow(renderer_));
+    SDL_DisplayMode mode;
+
+    if (display_index >= 0 && SDL_GetCurrentDisplayMode(display_index, &mode) == 0 && mode.refresh_rate > 0) {
+      refresh_rate_ = static_cast<uint32_t>(mode.refresh_rate);
+    }
+  }
+
+  skip_sample_ = true;
+  has_input_ = false;
+  display_changed_ = false;
+  last_frame_end_ = SDL_GetPerformanceCounter();
+}
+
+void FramePacer::Subscribe(EventBus& bus) {
+  // События доставляются в потоке симуляции, поэтому здесь только ставится отметка, а частота
+  // определяется заново в Update между кадрами.
+  bus.Listen<Events::WindowDisplayChanged>([this](std::span<const Events::WindowDisplayChanged>) {
+    display_changed_ = true;
+  });
+
+  bus.Listen<Events::DisplaysChanged>([this](std::span<const Events::DisplaysChanged>) {
+    display_changed_ = true;
+  });
+}
+
+bool FramePacer::Update() {
+  if (!display_changed_) {
+    return false;
+  }
+
+  auto previous_rate = refresh_rate_;
+  Restart();
+
+  if (refresh_rate_ != previous_rate) {
+    Logger::Info("Частота обновления дисплея изменилась: {} Гц.", refresh_rate_);
+  }
+
+  return true;
+}
+
+FramePacer::Stats FramePacer::GetStats(PacingMode mode) const {
+  const auto& frame_time = frame_times_[static_cast<size_t>(mode)];
+  const auto& latency = input_latencies_[static_cast<size_t>(mode)];
+
+  Stats stats;
+  stats.frames = frame_time.count;
+  stats.average_ms = frame_time.mean;
+  stats.deviation_ms = frame_time.count > 1 ? std::sqrt(frame_time.m2 / (frame_time.count - 1)) : 0.0;
+  stats.max_ms = frame_time.max;
+  stats.input_frames = latency.count;
+  stats.average_latency_ms = latency.mean;
+  stats.max_latency_ms = latency.max;
+  return stats;
+}
+
+void FramePacer::ResetStats() {
+  frame_times_.fill(Accumulator{});
+  input_latencies_.fill(Accumulator{});
+}
+
+void FramePacer::SetVSync(bool enabled) {
+  if (!renderer_) {
+    vsync_ = false;
+    return;
+  }
+
+  if (SDL_RenderSetVSync(renderer_, enabled ? 1 : 0) != 0) {
+    Logger::Warn("Не удалось {} вертикальную синхронизацию: {}", enabled ? "включить" : "выключить", SDL_GetError());
+    return;
+  }
+
+  vsync_ = enabled;
+}
+
+void FramePacer::WaitUntil(uint64_t deadline) const {
+  auto spin_margin = counter_frequency_ * kSpinMarginMs / 1000;
+
+  for (auto now = SDL_GetPerformanceCounter(); now < deadline; now = SDL_GetPerformanceCounter()) {
+    auto remaining = deadline - now;
+
+    if (remaining > spin_margin) {
+      SDL_Delay(static_cast<uint32_t>((remaining - spin_margin) * 1000 / counter_frequency_));
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+uint64_t FramePacer::GetPeriod(uint32_t rate) const {
+  return counter_frequency_ / std::max(rate, 1U);
+}
+
+} // namespace gb
@@ -0,0 +1,177 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_FRAME_PACER_H
+#define GUIDING_BREEZE_SRC_CORE_FRAME_PACER_H
+
+#include "core/events/event_bus.hpp"
+
+#include <sys/types.h>
+
+#include <array>
+#include <cstdint>
+
+#include "SDL_events.h"
+#include "SDL_render.h"
+
+namespace gb {
+
+/**
+ * @brief Способ выдерживания темпа кадров.
+ */
+enum class PacingMode : u_short {
+  VSync,    //< Вывод кадра ждет вертикальной синхронизации
+  Uncapped, //< Без ограничения
+  Capped,   //< Ограничение частоты кадров ожиданием до срока кадра
+  Adaptive, //< Вертикальная синхронизация, отключаемая, пока кадры не успевают к ней
+  Count     //< Количество режимов
+};
+
+/**
+ * @brief Выдерживание темпа кадров и измерение времени кадра и задержки ввода.
+ *
+ * Кадр заканчивается вызовом EndFrame сразу после SDL_RenderPresent. В режиме Capped
+ * EndFrame ждет срока следующего кадра: большая часть ожидания - сон, последние
+ * миллисекунды - активное ожидание, потому что точность сна ограничена квантом планировщика.
+ *
+ * Время кадра - интервал между концами соседних кадров. Задержка ввода - время от самого
+ * раннего события ввода кадра до завершения вывода этого кадра. Статистика ведется отдельно
+ * для каждого режима, чтобы их можно было сравнить.
+ */
+class FramePacer final {
+public:
+  /**
+   * @brief Статистика режима.
+   */
+  struct Stats {
+    uint64_t frames{0};             //< Количество измеренных кадров
+    double average_ms{0.0};         //< Среднее время кадра
+    double deviation_ms{0.0};       //< Стандартное отклонение времени кадра
+    double max_ms{0.0};             //< Наибольшее время кадра
+    uint64_t input_frames{0};       //< Количество кадров с событиями ввода
+    double average_latency_ms{0.0}; //< Средняя задержка от ввода до вывода кадра
+    double max_latency_ms{0.0};     //< Наибольшая задержка от ввода до вывода кадра
+  };
+
+private:
+  /**
+   * @brief Накопитель среднего и дисперсии по алгоритму Уэлфорда.
+   */
+  struct Accumulator {
+    uint64_t count{0}; //< Количество значений
+    double mean{0.0};  //< Среднее
+    double m2{0.0};    //< Сумма квадратов отклонений от среднего
+    double max{0.0};   //< Наибольшее значение
+
+    void Add(double value);
+  };
+
+private:
+  static constexpr auto kModeCount = static_cast<size_t>(PacingMode::Count);
+
+  SDL_Renderer* renderer_{nullptr};                     //< Отрисовщик, у которого переключается вертикальная синхронизация
+  PacingMode mode_{PacingMode::VSync};                  //< Текущий режим
+  uint32_t target_rate_{0};                             //< Ограничение частоты кадров; 0 - частота обновления дисплея
+  uint32_t refresh_rate_{60};                           //< Частота обновления дисплея окна
+  bool vsync_{false};                                   //< Включена ли вертикальная синхронизация у отрисовщика
+  uint32_t on_time_frames_{0};                          //< Кадров подряд, успевших к сроку, в адаптивном режиме
+  uint64_t counter_frequency_;                          //< Частота счетчика производительности
+  uint64_t last_frame_end_{0};                          //< Значение счетчика в конце прошлого кадра
+  uint64_t next_deadline_{0};                           //< Срок следующего кадра в режиме Capped
+  bool skip_sample_{true};                              //< Не учитывать следующий кадр: он начался до смены режима
+  bool display_changed_{false};                         //< Окно перешло на другой дисплей или дисплеи изменились
+  bool has_input_{false};                               //< Были ли события ввода в текущем кадре
+  uint32_t earliest_input_ms_{0};                       //< Время самого раннего события ввода кадра (SDL_GetTicks)
+  std::array<Accumulator, kModeCount> frame_times_;     //< Время кадра по режимам
+  std::array<Accumulator, kModeCount> input_latencies_; //< Задержка ввода по режимам
+
+public:
+  FramePacer();
+
+public:
+  /**
+   * @brief Установить отрисовщик и применить к нему текущий режим.
+   *
+   * @param renderer Отрисовщик или nullptr, если окна нет.
+   */
+  void SetRenderer(SDL_Renderer* renderer);
+
+  /**
+   * @brief Установить режим.
+   *
+   * @note Вертикальная синхронизация переключается через SDL_RenderSetVSync (SDL 2.0.18+).
+   */
+  void SetMode(PacingMode mode);
+
+  [[nodiscard]] PacingMode GetMode() const;
+
+  /**
+   * @brief Установить ограничение частоты кадров для режима Capped.
+   *
+   * @param target_rate Кадров в секунду; 0 - частота обновления дисплея.
+   */
+  void SetTargetRate(uint32_t target_rate);
+
+  [[nodiscard]] uint32_t GetTargetRate() const;
+
+  /**
+   * @brief Получить частоту обновления дисплея, на котором находится окно.
+   *
+   * @return uint32_t Частота в Гц; 60, если дисплей ее не сообщает.
+   */
+  [[nodiscard]] uint32_t GetRefreshRate() const;
+
+  /**
+   * @brief Включена ли сейчас вертикальная синхронизация.
+   */
+  [[nodiscard]] bool IsVSyncEnabled() const;
+
+  /**
+   * @brief Учесть событие SDL: события ввода отмечают начало отсчета задержки ввода.
+   */
+  void HandleEvent(const SDL_Event& event);
+
+  /**
+   * @brief Завершить кадр: измерить его и выдержать темп текущего режима.
+   *
+   * @note Вызывается сразу после SDL_RenderPresent.
+   */
+  void EndFrame();
+
+  /**
+   * @brief Начать отсчет заново после долгой паузы, например смены режима экрана.
+   *
+   * Заново определяет частоту обновления дисплея; следующий кадр не попадает в статистику.
+   */
+  void Restart();
+
+  /**
+   * @brief Подписаться на события окна и дисплеев: частота обновления определяется заново,
+   * если окно перешло на другой дисплей или изменились дисплеи.
+   */
+  void Subscribe(EventBus& bus);
+
+  /**
+   * @brief Начать отсчет заново, если с прошлого вызова изменился дисплей окна.
+   *
+   * @return true Если отсчет начат заново.
+   * @note Вызывается между кадрами из главного потока, после доставки событий логики.
+   */
+  bool Update();
+
+  /**
+   * @brief Получить статистику режима.
+   */
+  [[nodiscard]] Stats GetStats(PacingMode mode) const;
+
+  /**
+   * @brief Сбросить статистику всех режимов.
+   */
+  void ResetStats();
+
+private:
+  void SetVSync(bool enabled);
+  void WaitUntil(uint64_t deadline) const;
+  [[nodiscard]] uint64_t GetPeriod(uint32_t rate) const;
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_FRAME_PACER_H
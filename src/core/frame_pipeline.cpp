@@ -0,0 +1,109 @@
+#include "frame_pipeline.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <utility>
+
+namespace gb {
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  [[nodiscard]] double ToMs(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  }
+
+} // namespace
+
+FramePipeline::FramePipeline(uint32_t depth)
+  : depth_(std::min(depth, kMaxDepth)),
+    thread_(&FramePipeline::ThreadLoop, this) {
+}
+
+FramePipeline::~FramePipeline() noexcept {
+  Wait();
+
+  {
+    std::lock_guard lock(mutex_);
+    running_ = false;
+  }
+  condition_.notify_all();
+  thread_.join();
+}
+
+void FramePipeline::Run(Job job) {
+  if (depth_ == 0) {
+    auto begin = Clock::now();
+    job();
+    stats_.job_ms = ToMs(Clock::now() - begin);
+    stats_.wait_ms = 0.0;
+    return;
+  }
+
+  {
+    std::lock_guard lock(mutex_);
+    assert(!busy_);
+    job_ = std::move(job);
+    busy_ = true;
+  }
+  condition_.notify_all();
+}
+
+void FramePipeline::Wait() {
+  auto begin = Clock::now();
+
+  std::unique_lock lock(mutex_);
+  if (!busy_) {
+    stats_.wait_ms = 0.0;
+    return;
+  }
+
+  condition_.wait(lock, [this] {
+    return !busy_;
+  });
+  stats_.wait_ms = ToMs(Clock::now() - begin);
+}
+
+void FramePipeline::SetDepth(uint32_t depth) {
+  assert(!busy_);
+  depth_ = std::min(depth, kMaxDepth);
+}
+
+uint32_t FramePipeline::GetDepth() const {
+  return depth_;
+}
+
+const FramePipeline::Stats& FramePipeline::GetStats() const {
+  return stats_;
+}
+
+void FramePipeline::ThreadLoop() {
+  std::unique_lock lock(mutex_);
+
+  while (true) {
+    condition_.wait(lock, [this] {
+      return (busy_ && job_) || !running_;
+    });
+
+    if (!running_) {
+      return;
+    }
+
+    auto job = std::move(job_);
+    job_ = nullptr;
+    lock.unlock();
+
+    auto begin = Clock::now();
+    job();
+    auto job_ms = ToMs(Clock::now() - begin);
+
+    lock.lock();
+    stats_.job_ms = job_ms;
+    busy_ = false;
+    condition_.notify_all();
+  }
+}
+
+} // namespace gb
@@ -0,0 +1,95 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_FRAME_PIPELINE_H
+#define GUIDING_BREEZE_SRC_CORE_FRAME_PIPELINE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace gb {
+
+/**
+ * @brief Конвейер кадра: симуляция следующего кадра в отдельном потоке, пока главный поток выводит текущий.
+ *
+ * Отрисовщик SDL используется только из потока, создавшего окно, поэтому выводом кадра занимается
+ * главный поток, а на отдельный поток переносится задача симуляции: тики логики и извлечение
+ * отрисовки в RenderList. Пока поток симуляции считает кадр N+1, главный поток воспроизводит
+ * список кадра N и ждет в SDL_RenderPresent.
+ *
+ * Глубина конвейера - на сколько кадров симуляция опережает вывод: 0 - задача выполняется сразу
+ * в вызывающем потоке, 1 - в потоке симуляции. Больше одного кадра опережать нельзя: интерфейс
+ * кадра читает и меняет реестр, поэтому между задачами симуляции реестр должен быть свободен.
+ *
+ * @note Между Run и Wait вызывающий поток не должен обращаться к реестру и другим данным логики.
+ */
+class FramePipeline final {
+public:
+  using Job = std::function<void()>;
+
+  /**
+   * @brief Статистика последнего кадра.
+   */
+  struct Stats {
+    double job_ms{0.0};  //< Длительность задачи симуляции
+    double wait_ms{0.0}; //< Сколько вызывающий поток ждал завершения задачи
+  };
+
+  static constexpr uint32_t kMaxDepth = 1; //< Наибольшая глубина конвейера
+
+private:
+  uint32_t depth_;                    //< Глубина конвейера
+  std::mutex mutex_;                  //< Мьютекс задачи
+  std::condition_variable condition_; //< Условная переменная появления и завершения задачи
+  Job job_;                           //< Текущая задача
+  bool busy_{false};                  //< Задача передана потоку и еще выполняется
+  bool running_{true};                //< Флаг работы потока
+  Stats stats_;                       //< Статистика последнего кадра
+  std::thread thread_;                //< Поток симуляции; создается последним, когда остальные поля готовы
+
+public:
+  /**
+   * @param depth Глубина конвейера; ограничивается kMaxDepth.
+   */
+  explicit FramePipeline(uint32_t depth = kMaxDepth);
+  FramePipeline(const FramePipeline&) = delete;
+  FramePipeline(FramePipeline&&) = delete;
+  ~FramePipeline() noexcept;
+
+public:
+  FramePipeline& operator=(const FramePipeline&) = delete;
+  FramePipeline& operator=(FramePipeline&&) = delete;
+
+public:
+  /**
+   * @brief Выполнить задачу симуляции.
+   *
+   * @param job Задача; при глубине 0 выполняется сразу, иначе - в потоке симуляции.
+   * @note Предыдущая задача должна быть завершена вызовом Wait.
+   */
+  void Run(Job job);
+
+  /**
+   * @brief Дождаться завершения задачи симуляции.
+   */
+  void Wait();
+
+  /**
+   * @brief Задать глубину конвейера.
+   *
+   * @param depth Глубина; ограничивается kMaxDepth.
+   * @note Вызывается, пока задача не выполняется; применяется со следующего кадра.
+   */
+  void SetDepth(uint32_t depth);
+
+  [[nodiscard]] uint32_t GetDepth() const;
+
+  [[nodiscard]] const Stats& GetStats() const;
+
+private:
+  void ThreadLoop();
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_FRAME_PIPELINE_H
@@ -1,18 +1,42 @@
 #include "game.hpp"
 
+#include "core/assets/assets.hpp"
+#include "core/components/sprite_component.hpp"
 #include "core/components/test_component.hpp"
+#include "core/components/text_component.hpp"
+#include "core/components/transform_component.hpp"
+#include "core/events/event_bus.hpp"
+#include "core/events/game_events.hpp"
+#include "core/frame_pacer.hpp"
+#include "core/frame_pipeline.hpp"
+#include "core/input/input.hpp"
+#include "core/interface_cache.hpp"
+#include "core/jobs/thread_pool.hpp"
+#include "core/memory/frame_memory.hpp"
+#include "core/memory/registry_memory.hpp"
+#include "core/plugins/system_plugin.hpp"
+#include "core/render/render_list.hpp"
+#include "core/render/sprite_renderer.hpp"
+#include "core/render/text_renderer.hpp"
 #include "core/screen.hpp"
-#include "core/systems/system.hpp"
-#include "core/systems/test_system.hpp"
+#include "core/snapshot/snapshot.hpp"
+#include "core/spatial/spatial_grid.hpp"
+#include "core/systems/scheduler.hpp"
+#include "core/systems/storage_layout.hpp"
 #include "logger/logger.hpp"
+#include "profiler/profiler.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <memory>
+#include <random>
+#include <span>
 #include <string>
+#include <thread>
 
 #include "SDL_video.h"
 #include "entt/entt.hpp"
-#include "fmt/format.h"
 #include "imgui.h"
 
 namespace gb {
@@ -22,8 +46,65 @@ namespace {
   SDL_Window* window{nullptr}; //< Указатель на окно игры
   SDL_Renderer* renderer{nullptr}; //< Указатель на отрисовщик игры
   std::unique_ptr<entt::registry> registry; //< Реестр сущностей
-  std::vector<std::unique_ptr<System>> systems; //< Вектор систем, взаимодействующих с реестром сущностей
+  std::unique_ptr<ThreadPool> thread_pool; //< Общий пул рабочих потоков
+  std::unique_ptr<EventBus> event_bus; //< Шина событий между системами и модулями
+  std::unique_ptr<SpatialGrid> spatial_grid; //< Пространственный индекс сущностей с TransformComponent
+  std::unique_ptr<Scheduler> scheduler; //< Планировщик систем, взаимодействующих с реестром сущностей
+  std::unique_ptr<StorageLayout> storage_layout; //< Расположение хранилищ компонентов в памяти
+  std::unique_ptr<RegistryMemory> registry_memory; //< Учет памяти хранилищ реестра и бюджеты категорий
+  std::unique_ptr<SystemPlugin> system_plugin; //< Модуль с системами игрового процесса
+  SpriteRenderer sprite_renderer; //< Пакетный отрисовщик спрайтов
+  std::unique_ptr<TextRenderer> text_renderer; //< Отрисовщик надписей с кэшем раскладок
   bool should_exit; //< Флаг, указывающий на то, нужно ли прекратить игру после завершения текущего цикла
+  FixedTimestep timestep{60, 5}; //< Накопитель времени фиксированного шага: 60 тиков/с, до 5 тиков за кадр
+  FramePacer frame_pacer; //< Выдерживание темпа кадров
+  std::unique_ptr<FramePipeline> frame_pipeline; //< Конвейер кадра: симуляция следующего кадра во время вывода текущего
+  InterfaceCache interface_cache; //< Кэш кадра интерфейса
+  uint64_t seed{42}; //< Зерно генератора случайных чисел логики; постоянное, чтобы сеансы воспроизводились
+  std::mt19937_64 random{seed}; //< Генератор случайных чисел логики
+
+  constexpr float kSpatialCellSize = 128.0F; //< Размер ячейки пространственного индекса в пикселях
+  constexpr uint32_t kLayoutInterval = 60; //< Период упорядочивания хранилищ мира в тиках
+  constexpr float kCullMargin = 256.0F; //< Запас отсечения: спрайты индексируются по левому верхнему углу и не больше этого размера
+  constexpr const char* kTextFontPath = "res/fonts/minecraft_seven.ttf"; //< Шрифт надписей в мире
+  constexpr const char* kQuickSavePath = "quicksave.gbs"; //< Файл быстрого сохранения
+  constexpr size_t kEntityBudget = size_t{16} << 20; //< Бюджет памяти идентификаторов сущностей
+  constexpr size_t kWorldBudget = size_t{64} << 20; //< Бюджет памяти компонентов мира (положения и спрайты)
+  constexpr size_t kLogicBudget = size_t{32} << 20; //< Бюджет памяти компонентов логики
+
+} // namespace
+
+namespace Snapshot {
+
+  // Текстура - указатель текущего запуска, поэтому в снимок спрайт попадает без нее.
+  template<>
+  struct SaveTraits<SpriteComponent> {
+    static void Prepare(SpriteComponent& sprite) {
+      sprite.texture = nullptr;
+    }
+  };
+
+} // namespace Snapshot
+
+namespace {
+
+  /**
+   * @brief Набор компонентов, сохраняемых в снимок.
+   */
+  template<typename... Components>
+  struct SnapshotComponents {
+    static bool Save(const entt::registry& registry, const std::string& path, Snapshot::Compression compression) {
+      return Snapshot::Save<Components...>(registry, path, compression);
+    }
+
+    static bool Load(entt::registry& registry, const std::string& path) {
+      return Snapshot::Load<Components...>(registry, path);
+    }
+  };
+
+  // Набор и порядок компонентов определяют формат снимка мира: при их изменении старые
+  // снимки перестают загружаться, поэтому новые компоненты добавляются только в конец.
+  using WorldSnapshot = SnapshotComponents<TestComponent, TransformComponent, SpriteComponent>;
 
 } // namespace
 
@@ -41,39 +122,123 @@ void OnStart(SDL_Window* window, SDL_Renderer* renderer) {
 
   Logger::Info("Запуск игры...");
   Screen::SetResolution(1280, 720, 0, Screen::DisplayMode::Windowed);
+  frame_pacer.SetRenderer(renderer);
+  interface_cache.SetRenderer(renderer);
+
+  // Главный поток тоже выполняет задачи, пока ожидает их завершения.
+  auto worker_count = std::max(1U, std::thread::hardware_concurrency()) - 1;
+  thread_pool = std::make_unique<ThreadPool>(worker_count);
+  Logger::Info("Создан пул из {} рабочих потоков.", worker_count);
+
+  // События SDL переводятся в события игры в цикле опроса и доставляются после него
+  event_bus = std::make_unique<EventBus>(thread_pool.get());
+  Events::Register(*event_bus);
+  event_bus->Listen<Events::Quit>([](std::span<const Events::Quit>) {
+    RequestExit();
+  });
+  Screen::Subscribe(*event_bus);
+  frame_pacer.Subscribe(*event_bus);
+
+  frame_pipeline = std::make_unique<FramePipeline>();
 
   registry = std::make_unique<entt::registry>();
-  systems.emplace_back(std::make_unique<TestSystem>(registry.get()));
+  registry_memory = std::make_unique<RegistryMemory>(registry.get());
+  registry_memory->Track<TestComponent>("Логика");
+  registry_memory->Track<TransformComponent>("Мир");
+  registry_memory->Track<SpriteComponent>("Мир");
+  registry_memory->Track<TextComponent>("Мир");
+  registry_memory->SetBudget("Сущности", kEntityBudget);
+  registry_memory->SetBudget("Мир", kWorldBudget);
+  registry_memory->SetBudget("Логика", kLogicBudget);
+
+  spatial_grid = std::make_unique<SpatialGrid>(registry.get(), kSpatialCellSize);
+
+  // Расположение хранилищ объявляет только ядро: правила модуля систем ссылались бы на его код
+  // после выгрузки, а группы при повторной загрузке объявлялись бы заново. Отрисовка читает
+  // положения, спрайты и надписи видимых сущностей в порядке ответа SpatialGrid - по строкам
+  // ячеек, поэтому положения упорядочиваются так же, а спрайты и надписи выравниваются по ним.
+  storage_layout = std::make_unique<StorageLayout>(registry.get());
+  auto by_cell = [](const TransformComponent& lhs, const TransformComponent& rhs) {
+    auto lhs_y = std::floor(lhs.y / kSpatialCellSize);
+    auto rhs_y = std::floor(rhs.y / kSpatialCellSize);
+    if (lhs_y != rhs_y) {
+      return lhs_y < rhs_y;
+    }
+    return std::floor(lhs.x / kSpatialCellSize) < std::floor(rhs.x / kSpatialCellSize);
+  };
+  storage_layout->Sort<TransformComponent>(kLayoutInterval, by_cell);
+  storage_layout->Align<SpriteComponent, TransformComponent>(kLayoutInterval);
+  storage_layout->Align<TextComponent, TransformComponent>(kLayoutInterval);
+
+  // Хранилища создаются ядром до загрузки модуля систем: созданные его кодом хранилища
+  // ссылались бы на этот код после перезагрузки модуля.
+  registry->storage<TestComponent>();
+  registry->storage<TransformComponent>();
+  registry->storage<SpriteComponent>();
+  registry->storage<TextComponent>();
+
+  scheduler = std::make_unique<Scheduler>(thread_pool.get());
+  system_plugin = std::make_unique<SystemPlugin>(GB_GAMEPLAY_PLUGIN_PATH, scheduler.get(), registry.get());
+  system_plugin->Load();
+
+  // Размеры надписей запекаются заранее в пуле потоков; до готовности атласа надписи не выводятся
+  text_renderer = std::make_unique<TextRenderer>();
+  text_renderer->Load(kTextFontPath, {12.0F, 16.0F, 24.0F, 32.0F}, &scheduler->GetTasks());
 
   auto entity = registry->create();
   registry->emplace<TestComponent>(entity, 0);
+
+  auto square = registry->create();
+  registry->emplace<TransformComponent>(square, 50.0F, 50.0F);
+  registry->emplace<SpriteComponent>(
+    square, 100.0F, 100.0F, SDL_Color{255, 0, 0, 255}, nullptr, SDL_FRect{0.0F, 0.0F, 1.0F, 1.0F}, 0,
+    SDL_BLENDMODE_NONE
+  );
 }
 
-void Update() {
-  for (auto& system : systems) {
-    system->Update();
-  }
+void Update(float delta) {
+  Input::BeginTick();
+  scheduler->Update(delta);
+  storage_layout->Update();
+  registry_memory->Update();
+
+  // События систем этого тика доставляются до следующего тика
+  event_bus->Dispatch();
 }
 
-void Render() {
+void Extract(RenderList& list, float) {
+  // Спрайты записываются в список до интерфейса, который выводится поверх них; невидимые отсекаются индексом
+  auto visible = spatial_grid->QueryRange(
+    -kCullMargin, -kCullMargin, static_cast<float>(list.GetWidth()), static_cast<float>(list.GetHeight())
+  );
+  sprite_renderer.Extract(*registry, visible, list);
+
+  // Надписи выводятся поверх спрайтов общей командой
+  text_renderer->Extract(*registry, visible, list);
+}
+
+void Render(float) {
   ImGui::Begin("Настройки", nullptr, ImGuiWindowFlags_AlwaysAutoResize);
   
   ImGui::SeparatorText("Графика");
 
-  // Получение данных о разрешениях
+  // Получение данных о разрешениях; подписи и индекс текущего режима кэшируются в Screen
   const auto& resolutions = Screen::GetAvailableResolutions();
-  const auto& active_resolution = Screen::GetResolution();
-  static int selected_resolution_index = std::find_if(resolutions.begin(), resolutions.end(), [active_resolution](const auto& r) {
-    return r.width == active_resolution.width && r.height == active_resolution.height && r.refresh_rate == active_resolution.refresh_rate;
-  }) - resolutions.begin();
+  const auto& labels = Screen::GetResolutionLabels();
+
+  // Выбор сбрасывается на текущее разрешение, только когда меняются режимы дисплея или текущий режим
+  static auto resolution_revision = Screen::GetRevision();
+  static auto selected_resolution_index = Screen::GetActiveResolutionIndex();
+  if (resolution_revision != Screen::GetRevision()) {
+    resolution_revision = Screen::GetRevision();
+    selected_resolution_index = Screen::GetActiveResolutionIndex();
+  }
 
   // Отрисовка всплывающего списка для выбора разрешения
-  if (ImGui::BeginCombo("Разрешение", fmt::format("{}x{} {}hz", resolutions[selected_resolution_index].width, resolutions[selected_resolution_index].height, resolutions[selected_resolution_index].refresh_rate).c_str())) {
-    for (size_t i = 0; i < resolutions.size(); i++) {
-      const auto& resolution = resolutions[i];
-      auto selected = (selected_resolution_index == i);
-
-      if (ImGui::Selectable(fmt::format("{}x{} {}hz", resolution.width, resolution.height, resolution.refresh_rate).c_str(), &selected)) {
+  const auto* preview = selected_resolution_index >= 0 ? labels[selected_resolution_index].c_str() : "Размер окна";
+  if (ImGui::BeginCombo("Разрешение", preview)) {
+    for (auto i = 0; i < static_cast<int>(labels.size()); i++) {
+      if (ImGui::Selectable(labels[i].c_str(), selected_resolution_index == i)) {
         selected_resolution_index = i;
       }
     }
@@ -81,32 +246,182 @@ void Render() {
   }
 
   // Отрисовка всплывающего списка выбора режима экрана
-  static auto mode = Screen::DisplayMode::Windowed;
+  static auto mode = Screen::GetDisplayMode();
   static const char* modes[] = {"Windowed", "Borderless", "Fullscreen"};
   int item_current = static_cast<int>(mode);
   if (ImGui::Combo("Режим", &item_current, modes, IM_ARRAYSIZE(modes))) {
     mode = static_cast<Screen::DisplayMode>(item_current);
   }
 
+  // Темп кадров применяется сразу: переключение синхронизации не меняет режим экрана
+  static const char* pacing_modes[] = {"VSync", "Без ограничения", "Ограничение", "Адаптивный"};
+  auto pacing_mode = static_cast<int>(frame_pacer.GetMode());
+  if (ImGui::Combo("Темп кадров", &pacing_mode, pacing_modes, IM_ARRAYSIZE(pacing_modes))) {
+    frame_pacer.SetMode(static_cast<PacingMode>(pacing_mode));
+  }
+
+  if (frame_pacer.GetMode() == PacingMode::Capped) {
+    auto target_rate = static_cast<int>(frame_pacer.GetTargetRate());
+    if (ImGui::SliderInt("Кадров/с", &target_rate, 0, 360, target_rate == 0 ? "частота дисплея" : "%d")) {
+      frame_pacer.SetTargetRate(static_cast<uint32_t>(target_rate));
+    }
+  }
+
+  // Замеры времени кадра и задержки ввода по режимам темпа
+  ImGui::Text("Дисплей: %u Гц, VSync %s", frame_pacer.GetRefreshRate(), frame_pacer.IsVSyncEnabled() ? "включен" : "выключен");
+  for (auto i = size_t{0}; i < IM_ARRAYSIZE(pacing_modes); i++) {
+    auto stats = frame_pacer.GetStats(static_cast<PacingMode>(i));
+    if (stats.frames == 0) {
+      continue;
+    }
+
+    ImGui::Text(
+      "%s: кадр %.2f ± %.2f мс (макс. %.2f), ввод %.1f мс (макс. %.1f)", pacing_modes[i], stats.average_ms,
+      stats.deviation_ms, stats.max_ms, stats.average_latency_ms, stats.max_latency_ms
+    );
+  }
+  if (ImGui::Button("Сбросить замеры")) {
+    frame_pacer.ResetStats();
+  }
+
+  ImGui::SeparatorText("Интерфейс");
+
+  // Кэш интерфейса: без ввода окна перестраиваются с заданной частотой, а между перестроениями
+  // выводится готовая текстура
+  auto cache_enabled = interface_cache.IsEnabled();
+  if (ImGui::Checkbox("Кэшировать интерфейс", &cache_enabled)) {
+    interface_cache.SetEnabled(cache_enabled);
+  }
+
+  if (interface_cache.IsEnabled()) {
+    auto rebuild_rate = static_cast<int>(interface_cache.GetRebuildRate());
+    if (ImGui::SliderInt("Обновлений/с", &rebuild_rate, 0, 60, rebuild_rate == 0 ? "каждый кадр" : "%d")) {
+      interface_cache.SetRebuildRate(static_cast<uint32_t>(rebuild_rate));
+    }
+
+    const auto& cache_stats = interface_cache.GetStats();
+    ImGui::Text(
+      "Перестроено кадров: %llu из %llu, отрисовок в текстуру: %llu", static_cast<unsigned long long>(cache_stats.rebuilds),
+      static_cast<unsigned long long>(cache_stats.frames), static_cast<unsigned long long>(cache_stats.uploads)
+    );
+    if (ImGui::Button("Сбросить счетчики")) {
+      interface_cache.ResetStats();
+    }
+  }
+
+  ImGui::SeparatorText("Симуляция");
+
+  // Частота обновления логики
+  auto tick_rate = static_cast<int>(timestep.GetTickRate());
+  if (ImGui::SliderInt("Тиков/с", &tick_rate, 10, 240)) {
+    timestep.SetTickRate(static_cast<uint32_t>(tick_rate));
+  }
+
+  // Быстрое сохранение и загрузка мира
+  if (ImGui::Button("Сохранить (F5)") || ImGui::IsKeyPressed(ImGuiKey_F5, false)) {
+    Game::SaveWorld(kQuickSavePath);
+  }
+  ImGui::SameLine();
+  if (ImGui::Button("Загрузить (F9)") || ImGui::IsKeyPressed(ImGuiKey_F9, false)) {
+    Game::LoadWorld(kQuickSavePath);
+  }
+
+  ImGui::SeparatorText("Отрисовка");
+
+  // Статистика пакетного отрисовщика
+  const auto& stats = sprite_renderer.GetStats();
+  ImGui::Text("Спрайтов: %zu", stats.sprites);
+  ImGui::Text("Вызовов отрисовки: %zu", stats.draw_calls);
+  ImGui::Text("Вершин: %zu, индексов: %zu", stats.vertices, stats.indices);
+
+  const auto& text_stats = text_renderer->GetStats();
+  if (text_renderer->IsReady()) {
+    ImGui::Text("Надписей: %zu, глифов: %zu", text_stats.labels, text_stats.glyphs);
+    ImGui::Text(
+      "Раскладок: заново %zu, в кэше %zu, удалено %zu", text_stats.shaped, text_stats.cached, text_stats.evicted
+    );
+  } else {
+    ImGui::TextUnformatted("Надписи: шрифт запекается");
+  }
+
+  // Глубина конвейера применяется со следующего кадра: сейчас задача симуляции не выполняется
+  static const char* pipeline_modes[] = {"Последовательно", "Симуляция во время вывода"};
+  auto pipeline_depth = static_cast<int>(frame_pipeline->GetDepth());
+  if (ImGui::Combo("Конвейер кадра", &pipeline_depth, pipeline_modes, IM_ARRAYSIZE(pipeline_modes))) {
+    frame_pipeline->SetDepth(static_cast<uint32_t>(pipeline_depth));
+  }
+
+  const auto& pipeline_stats = frame_pipeline->GetStats();
+  ImGui::Text("Симуляция: %.2f мс, ожидание симуляции: %.2f мс", pipeline_stats.job_ms, pipeline_stats.wait_ms);
+
+  ImGui::SeparatorText("Хранилища");
+
+  const auto& layout_stats = storage_layout->GetStats();
+  ImGui::Text("Групп: %zu, правил упорядочивания: %zu", layout_stats.groups, layout_stats.rules);
+  ImGui::Text("Упорядочиваний: %llu, последнее: %.2f мс", static_cast<unsigned long long>(layout_stats.sorts), layout_stats.last_ms);
+
+  ImGui::SeparatorText("Модуль систем");
+
+  const auto& plugin_stats = system_plugin->GetStats();
+  ImGui::Text("Систем: %zu, перезагрузок: %u, ошибок: %u", plugin_stats.systems, plugin_stats.reloads, plugin_stats.failures);
+  ImGui::Text("Последняя загрузка: %.2f мс", plugin_stats.last_load_ms);
+  if (ImGui::Button("Перезагрузить модуль")) {
+    system_plugin->Load();
+  }
+
+  ImGui::SeparatorText("Задачи");
+
+  // Статистика защищена мьютексом: тик может выполняться в потоке конвейера кадра.
+  auto task_stats = scheduler->GetTasks().GetStats();
+  ImGui::Text("Выполняется: %zu, продолжений в очередях: %zu", task_stats.active, task_stats.queued);
+  ImGui::Text(
+    "Запущено: %llu, завершено: %llu, отменено: %llu", static_cast<unsigned long long>(task_stats.launched),
+    static_cast<unsigned long long>(task_stats.completed), static_cast<unsigned long long>(task_stats.cancelled)
+  );
+  ImGui::Text("Продолжения в потоке логики: %.2f мс", task_stats.update_ms);
+
+  ImGui::SeparatorText("Память");
+
+  const auto& memory_stats = FrameMemory::GetStats();
+  if (memory_stats.counting) {
+    ImGui::Text("Выделений в куче за кадр: %llu", static_cast<unsigned long long>(memory_stats.heap_allocations));
+  } else {
+    ImGui::TextUnformatted("Выделений в куче за кадр: не подсчитывается");
+  }
+  ImGui::Text(
+    "Арены кадра: %zu, занято %.1f из %.1f КиБ", memory_stats.arena_count, memory_stats.arena_used / 1024.0,
+    memory_stats.arena_capacity / 1024.0
+  );
+
   ImGui::Separator();
 
   // Кнопчка
   if (ImGui::Button("Применить")) {
-    Screen::SetResolution(resolutions[selected_resolution_index], mode);
+    Screen::SetResolution(selected_resolution_index >= 0 ? resolutions[selected_resolution_index] : Screen::GetResolution(), mode);
   }
 
   ImGui::End();
 
-  // Отрисовка квадрата
-  SDL_Rect rect{50, 50, 100, 100};
-  SDL_SetRenderDrawColor(renderer, 255, 0, 0, 0);
-  SDL_RenderFillRect( renderer, &rect );
+  Profiler::DrawWindow();
+  Assets::DrawWindow();
+  registry_memory->DrawWindow();
 }
 
 void OnExit() {
-  systems.clear();
+  frame_pipeline.reset();
+  sprite_renderer = SpriteRenderer{};
+  text_renderer.reset();
+  system_plugin.reset();
+  scheduler.reset();
+  storage_layout.reset();
+  spatial_grid.reset();
+  registry_memory.reset();
   registry.reset();
+  event_bus.reset();
+  thread_pool.reset();
 
+  frame_pacer.SetRenderer(nullptr);
+  interface_cache.SetRenderer(nullptr);
   gb::window = nullptr;
   gb::renderer = nullptr;
 
@@ -123,6 +438,93 @@ namespace Game {
     return renderer;
   }
 
+  entt::registry& GetRegistry() {
+    return *registry;
+  }
+
+  SpatialGrid& GetSpatialGrid() {
+    return *spatial_grid;
+  }
+
+  StorageLayout& GetStorageLayout() {
+    return *storage_layout;
+  }
+
+  RegistryMemory& GetRegistryMemory() {
+    return *registry_memory;
+  }
+
+  ThreadPool& GetThreadPool() {
+    return *thread_pool;
+  }
+
+  TextRenderer& GetTextRenderer() {
+    return *text_renderer;
+  }
+
+  TaskScheduler& GetTaskScheduler() {
+    return scheduler->GetTasks();
+  }
+
+  EventBus& GetEventBus() {
+    return *event_bus;
+  }
+
+  SystemPlugin& GetSystemPlugin() {
+    return *system_plugin;
+  }
+
+  FixedTimestep& GetTimestep() {
+    return timestep;
+  }
+
+  FramePacer& GetFramePacer() {
+    return frame_pacer;
+  }
+
+  FramePipeline& GetFramePipeline() {
+    return *frame_pipeline;
+  }
+
+  InterfaceCache& GetInterfaceCache() {
+    return interface_cache;
+  }
+
+  void SetSeed(uint64_t value) {
+    seed = value;
+    random.seed(seed);
+  }
+
+  uint64_t GetSeed() {
+    return seed;
+  }
+
+  std::mt19937_64& GetRandom() {
+    return random;
+  }
+
+  bool SaveWorld(const std::string& path, Snapshot::Compression compression) {
+    auto begin = std::chrono::steady_clock::now();
+    if (!WorldSnapshot::Save(*registry, path, compression)) {
+      return false;
+    }
+
+    auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    Logger::Info("Мир сохранен в \"{}\" за {:.1f} мс.", path, ms);
+    return true;
+  }
+
+  bool LoadWorld(const std::string& path) {
+    auto begin = std::chrono::steady_clock::now();
+    if (!WorldSnapshot::Load(*registry, path)) {
+      return false;
+    }
+
+    auto ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+    Logger::Info("Мир загружен из \"{}\" за {:.1f} мс.", path, ms);
+    return true;
+  }
+
   void Stop() {
     RequestExit();
   }
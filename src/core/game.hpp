@@ -1,7 +1,26 @@
 #ifndef GUIDING_BREEZE_SRC_CORE_GAME_H
 #define GUIDING_BREEZE_SRC_CORE_GAME_H
 
+#include "core/events/event_bus.hpp"
+#include "core/frame_pacer.hpp"
+#include "core/frame_pipeline.hpp"
+#include "core/interface_cache.hpp"
+#include "core/jobs/task_scheduler.hpp"
+#include "core/jobs/thread_pool.hpp"
+#include "core/memory/registry_memory.hpp"
+#include "core/plugins/system_plugin.hpp"
+#include "core/render/text_renderer.hpp"
+#include "core/snapshot/archive.hpp"
+#include "core/spatial/spatial_grid.hpp"
+#include "core/systems/storage_layout.hpp"
+#include "core/timestep.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+
 #include "SDL_render.h"
+#include "entt/entt.hpp"
 
 namespace gb::Game {
 
@@ -19,6 +38,141 @@ namespace gb::Game {
  */
 [[nodiscard]] SDL_Renderer* GetRenderer();
 
+/**
+ * @brief Получить реестр сущностей.
+ *
+ * @return entt::registry& Реестр сущностей; существует между OnStart и OnExit.
+ */
+[[nodiscard]] entt::registry& GetRegistry();
+
+/**
+ * @brief Получить пространственный индекс сущностей с TransformComponent.
+ *
+ * @return SpatialGrid& Индекс для запросов соседей и отсечения; существует между OnStart и OnExit.
+ */
+[[nodiscard]] SpatialGrid& GetSpatialGrid();
+
+/**
+ * @brief Получить расположение хранилищ компонентов.
+ *
+ * @return StorageLayout& Группы и правила упорядочивания хранилищ; существует между OnStart и OnExit.
+ * @note Группы и правила объявляет ядро в OnStart. Модули систем их не объявляют: удалить их
+ * при выгрузке модуля нельзя, и правила ссылались бы на код выгруженного модуля.
+ */
+[[nodiscard]] StorageLayout& GetStorageLayout();
+
+/**
+ * @brief Получить учет памяти реестра сущностей.
+ *
+ * @return RegistryMemory& Память хранилищ, бюджеты категорий и сжатие хранилищ, например между
+ * уровнями; существует между OnStart и OnExit.
+ */
+[[nodiscard]] RegistryMemory& GetRegistryMemory();
+
+/**
+ * @brief Получить общий пул рабочих потоков.
+ *
+ * @return ThreadPool& Пул рабочих потоков; существует между OnStart и OnExit.
+ */
+[[nodiscard]] ThreadPool& GetThreadPool();
+
+/**
+ * @brief Получить отрисовщик надписей.
+ *
+ * @return TextRenderer& Надписи сущностей с TextComponent и текст интерфейса игры (Draw из Extract);
+ * существует между OnStart и OnExit.
+ */
+[[nodiscard]] TextRenderer& GetTextRenderer();
+
+/**
+ * @brief Получить планировщик задач систем.
+ *
+ * @return TaskScheduler& Задачи для долгой работы в пуле потоков; продолжения в потоке логики
+ * выполняются в начале тика. Существует между OnStart и OnExit.
+ */
+[[nodiscard]] TaskScheduler& GetTaskScheduler();
+
+/**
+ * @brief Получить шину событий.
+ *
+ * @return EventBus& Шина; события доставляются после опроса событий SDL и в конце каждого тика.
+ * Существует между OnStart и OnExit.
+ */
+[[nodiscard]] EventBus& GetEventBus();
+
+/**
+ * @brief Получить модуль с системами игрового процесса.
+ *
+ * @return SystemPlugin& Модуль; существует между OnStart и OnExit.
+ */
+[[nodiscard]] SystemPlugin& GetSystemPlugin();
+
+/**
+ * @brief Получить накопитель времени фиксированного шага обновления логики.
+ *
+ * @return FixedTimestep& Накопитель времени; через него настраиваются частота тиков
+ * и максимальное количество догоняемых за кадр тиков.
+ */
+[[nodiscard]] FixedTimestep& GetTimestep();
+
+/**
+ * @brief Получить выдерживание темпа кадров.
+ *
+ * @return FramePacer& Режим темпа, ограничение частоты кадров и замеры времени кадра.
+ */
+[[nodiscard]] FramePacer& GetFramePacer();
+
+/**
+ * @brief Получить конвейер кадра.
+ *
+ * @return FramePipeline& Конвейер, в потоке которого симулируется следующий кадр; существует между OnStart и OnExit.
+ */
+[[nodiscard]] FramePipeline& GetFramePipeline();
+
+/**
+ * @brief Получить кэш кадра интерфейса.
+ *
+ * @return InterfaceCache& Кэш, пропускающий построение и отправку интерфейса без ввода и изменений.
+ */
+[[nodiscard]] InterfaceCache& GetInterfaceCache();
+
+/**
+ * @brief Заново засеять генератор случайных чисел логики.
+ *
+ * @param value Зерно; при воспроизведении записи ввода берется из нее.
+ */
+void SetSeed(uint64_t value);
+
+/**
+ * @brief Получить зерно генератора случайных чисел логики.
+ */
+[[nodiscard]] uint64_t GetSeed();
+
+/**
+ * @brief Получить генератор случайных чисел логики.
+ *
+ * @return std::mt19937_64& Генератор; используется только из логики, чтобы записанный сеанс
+ * воспроизводился одинаково.
+ */
+[[nodiscard]] std::mt19937_64& GetRandom();
+
+/**
+ * @brief Сохранить мир в снимок.
+ *
+ * @param path Путь к файлу.
+ * @param compression Сжатие снимка.
+ * @return true Если снимок записан.
+ */
+bool SaveWorld(const std::string& path, Snapshot::Compression compression = Snapshot::Compression::Lz);
+
+/**
+ * @brief Заменить мир снимком из файла.
+ *
+ * @param path Путь к файлу.
+ * @return true Если снимок загружен.
+ */
+bool LoadWorld(const std::string& path);
+
 /**
  * @brief Завершить работу игры.
  */
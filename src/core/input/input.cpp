@@ -0,0 +1,466 @@
+#include "input.hpp"
+
+#include "logger/logger.hpp"
+
+#include <bitset>
+#include <cstdio>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+namespace gb::Input {
+
+namespace {
+
+  constexpr uint32_t kMagic = 0x52494247; //< Сигнатура файла записи "GBIR"
+  constexpr uint32_t kVersion = 2; //< Версия формата записи
+  constexpr long kTickCountOffset = 20; //< Смещение количества тиков в заголовке
+  constexpr size_t kFlushSize = 64 * 1024; //< Размер буфера записи, после которого он сбрасывается в файл
+
+  Mode mode{Mode::Live}; //< Текущий режим
+  uint64_t next_tick{0}; //< Номер следующего тика; события из SDL относятся к нему
+
+  std::vector<Event> pending; //< События из SDL, ожидающие следующего тика
+  std::vector<Event> events; //< События текущего тика
+
+  std::bitset<SDL_NUM_SCANCODES> keys; //< Нажатые клавиши
+  uint32_t mouse_buttons{0}; //< Маска нажатых кнопок мыши
+  int32_t mouse_x{0}; //< Положение мыши по X
+  int32_t mouse_y{0}; //< Положение мыши по Y
+
+  std::FILE* record_file{nullptr}; //< Файл записи
+  std::vector<uint8_t> record_buffer; //< Закодированные, но еще не записанные события
+  uint64_t record_start_tick{0}; //< Тик начала записи; в файле тики отсчитываются от него
+  uint64_t record_last_tick{0}; //< Тик последнего записанного события относительно начала
+  uint64_t record_flush_tick{0}; //< Тик последнего сброса записи в файл
+  uint32_t record_tick_rate{0}; //< Частота тиков записи; запись сбрасывается в файл раз в секунду
+  bool record_failed{false}; //< Была ли ошибка записи
+
+  std::vector<Event> replay_events; //< События воспроизводимой записи; тики относительно начала
+  size_t replay_cursor{0}; //< Индекс следующего события записи
+  uint64_t replay_start_tick{0}; //< Тик начала воспроизведения
+  uint64_t replay_seed{0}; //< Зерно записи
+  uint32_t replay_tick_rate{0}; //< Частота тиков записи
+  uint64_t replay_tick_count{0}; //< Количество тиков записи
+  std::string replay_world; //< Путь к снимку начального мира записи; пустой, если мир не сохранялся
+
+  void WriteVarint(uint64_t value) {
+    while (value >= 0x80) {
+      record_buffer.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    record_buffer.push_back(static_cast<uint8_t>(value));
+  }
+
+  void WriteSigned(int32_t value) {
+    WriteVarint((static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+  }
+
+  template<typename T>
+  void WriteFixed(std::vector<uint8_t>& buffer, T value) {
+    for (auto i = size_t{0}; i < sizeof(T); i++) {
+      buffer.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+  }
+
+  /**
+   * @brief Дописать закодированные события в файл и обновить количество тиков в заголовке.
+   *
+   * @note Файл после сброса - целая запись: при аварийном завершении игры теряются только
+   * события после последнего сброса.
+   */
+  void FlushRecord() {
+    if (!record_buffer.empty() && std::fwrite(record_buffer.data(), 1, record_buffer.size(), record_file) != record_buffer.size()) {
+      record_failed = true;
+    }
+    record_buffer.clear();
+
+    std::vector<uint8_t> tick_count;
+    WriteFixed(tick_count, next_tick - record_start_tick);
+    if (std::fseek(record_file, kTickCountOffset, SEEK_SET) != 0
+      || std::fwrite(tick_count.data(), 1, tick_count.size(), record_file) != tick_count.size()
+      || std::fseek(record_file, 0, SEEK_END) != 0 || std::fflush(record_file) != 0) {
+      record_failed = true;
+    }
+    record_flush_tick = next_tick;
+  }
+
+  void Record(const Event& event) {
+    auto tick = event.tick - record_start_tick;
+    WriteVarint(tick - record_last_tick);
+    record_last_tick = tick;
+
+    record_buffer.push_back(static_cast<uint8_t>(event.type));
+    switch (event.type) {
+      case EventType::KeyDown:
+      case EventType::KeyUp:
+        WriteVarint(static_cast<uint32_t>(event.code));
+        break;
+      case EventType::MouseButtonDown:
+      case EventType::MouseButtonUp:
+        WriteVarint(static_cast<uint32_t>(event.code));
+        WriteSigned(event.x);
+        WriteSigned(event.y);
+        break;
+      case EventType::MouseMotion:
+      case EventType::MouseWheel:
+        WriteSigned(event.x);
+        WriteSigned(event.y);
+        break;
+    }
+
+    if (record_buffer.size() >= kFlushSize) {
+      FlushRecord();
+    }
+  }
+
+  /**
+   * @brief Последовательное чтение закодированной записи с проверкой границ.
+   */
+  struct Reader {
+    const uint8_t* data; //< Текущая позиция
+    const uint8_t* end; //< Конец данных
+    bool failed{false}; //< Вышло ли чтение за границы данных
+
+    uint64_t ReadVarint() {
+      auto value = uint64_t{0};
+      for (auto shift = 0; shift < 64; shift += 7) {
+        if (data == end) {
+          break;
+        }
+        auto byte = *data++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+          return value;
+        }
+      }
+      failed = true;
+      return 0;
+    }
+
+    int32_t ReadSigned() {
+      auto value = static_cast<uint32_t>(ReadVarint());
+      return static_cast<int32_t>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+    template<typename T>
+    T ReadFixed() {
+      auto value = T{0};
+      if (static_cast<size_t>(end - data) < sizeof(T)) {
+        failed = true;
+        return value;
+      }
+      for (auto i = size_t{0}; i < sizeof(T); i++) {
+        value |= static_cast<T>(data[i]) << (i * 8);
+      }
+      data += sizeof(T);
+      return value;
+    }
+  };
+
+  void Apply(const Event& event) {
+    switch (event.type) {
+      case EventType::KeyDown:
+      case EventType::KeyUp:
+        if (event.code >= 0 && event.code < SDL_NUM_SCANCODES) {
+          keys[static_cast<size_t>(event.code)] = event.type == EventType::KeyDown;
+        }
+        break;
+      case EventType::MouseButtonDown:
+      case EventType::MouseButtonUp:
+        if (event.code > 0 && event.code <= 32) {
+          auto mask = uint32_t{1} << (event.code - 1);
+          mouse_buttons = event.type == EventType::MouseButtonDown ? mouse_buttons | mask : mouse_buttons & ~mask;
+        }
+        mouse_x = event.x;
+        mouse_y = event.y;
+        break;
+      case EventType::MouseMotion:
+        mouse_x = event.x;
+        mouse_y = event.y;
+        break;
+      case EventType::MouseWheel:
+        break;
+    }
+  }
+
+} // namespace
+
+void Push(const SDL_Event& event) {
+  if (mode == Mode::Replay) {
+    return;
+  }
+
+  switch (event.type) {
+    case SDL_KEYDOWN:
+    case SDL_KEYUP:
+      // Автоповтор не меняет состояние клавиш и только раздувает запись.
+      if (event.key.repeat) {
+        return;
+      }
+      pending.push_back(Event{
+        next_tick, event.type == SDL_KEYDOWN ? EventType::KeyDown : EventType::KeyUp, static_cast<int32_t>(event.key.keysym.scancode), 0, 0
+      });
+      break;
+    case SDL_MOUSEMOTION:
+      pending.push_back(Event{next_tick, EventType::MouseMotion, 0, event.motion.x, event.motion.y});
+      break;
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+      pending.push_back(Event{
+        next_tick, event.type == SDL_MOUSEBUTTONDOWN ? EventType::MouseButtonDown : EventType::MouseButtonUp, event.button.button,
+        event.button.x, event.button.y
+      });
+      break;
+    case SDL_MOUSEWHEEL:
+      pending.push_back(Event{next_tick, EventType::MouseWheel, 0, event.wheel.x, event.wheel.y});
+      break;
+    default:
+      break;
+  }
+}
+
+void BeginTick() {
+  auto tick = next_tick++;
+  events.clear();
+
+  if (mode == Mode::Replay) {
+    while (replay_cursor < replay_events.size() && replay_events[replay_cursor].tick + replay_start_tick == tick) {
+      auto event = replay_events[replay_cursor++];
+      event.tick = tick;
+      events.push_back(event);
+    }
+  } else {
+    // Все накопленные события относятся к этому тику, даже если кадр догоняет несколько тиков.
+    for (auto& event : pending) {
+      event.tick = tick;
+      events.push_back(event);
+    }
+    pending.clear();
+  }
+
+  for (const auto& event : events) {
+    Apply(event);
+    if (mode == Mode::Recording) {
+      Record(event);
+    }
+  }
+
+  if (mode == Mode::Recording && next_tick - record_flush_tick >= record_tick_rate) {
+    FlushRecord();
+  }
+}
+
+std::span<const Event> GetEvents() {
+  return events;
+}
+
+bool IsKeyDown(SDL_Scancode scancode) {
+  return scancode >= 0 && scancode < SDL_NUM_SCANCODES && keys[static_cast<size_t>(scancode)];
+}
+
+bool IsMouseButtonDown(int32_t button) {
+  return button > 0 && button <= 32 && (mouse_buttons & (uint32_t{1} << (button - 1)));
+}
+
+void GetMousePosition(int32_t& x, int32_t& y) {
+  x = mouse_x;
+  y = mouse_y;
+}
+
+uint64_t GetTick() {
+  return next_tick;
+}
+
+bool StartRecording(const std::string& path, uint64_t seed, uint32_t tick_rate, const std::string& world) {
+  if (mode == Mode::Recording) {
+    StopRecording();
+  } else if (mode == Mode::Replay) {
+    StopReplay();
+  }
+
+  record_file = std::fopen(path.c_str(), "wb");
+  if (!record_file) {
+    Logger::Error("Не удалось создать файл записи ввода \"{}\".", path);
+    return false;
+  }
+
+  record_buffer.clear();
+  WriteFixed(record_buffer, kMagic);
+  WriteFixed(record_buffer, kVersion);
+  WriteFixed(record_buffer, seed);
+  WriteFixed(record_buffer, tick_rate);
+  WriteFixed(record_buffer, uint64_t{0});
+
+  auto world_name = world.empty() ? std::string{} : std::filesystem::path(world).filename().string();
+  WriteFixed(record_buffer, static_cast<uint32_t>(world_name.size()));
+  record_buffer.insert(record_buffer.end(), world_name.begin(), world_name.end());
+
+  record_start_tick = next_tick;
+  record_last_tick = 0;
+  record_flush_tick = next_tick;
+  record_tick_rate = tick_rate;
+  record_failed = false;
+  mode = Mode::Recording;
+
+  Logger::Info("Запись ввода в \"{}\" начата.", path);
+  return true;
+}
+
+bool StopRecording() {
+  if (mode != Mode::Recording) {
+    return false;
+  }
+
+  FlushRecord();
+
+  if (std::fclose(record_file) != 0) {
+    record_failed = true;
+  }
+  record_file = nullptr;
+  mode = Mode::Live;
+
+  if (record_failed) {
+    Logger::Error("Не удалось сохранить запись ввода.");
+    return false;
+  }
+
+  Logger::Info("Запись ввода завершена: {} тиков.", next_tick - record_start_tick);
+  return true;
+}
+
+bool StartReplay(const std::string& path) {
+  auto* file = std::fopen(path.c_str(), "rb");
+  if (!file) {
+    Logger::Error("Не удалось открыть файл записи ввода \"{}\".", path);
+    return false;
+  }
+
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  for (auto read = std::fread(chunk, 1, sizeof(chunk), file); read > 0; read = std::fread(chunk, 1, sizeof(chunk), file)) {
+    data.insert(data.end(), chunk, chunk + read);
+  }
+  std::fclose(file);
+
+  Reader reader{data.data(), data.data() + data.size()};
+  auto magic = reader.ReadFixed<uint32_t>();
+  auto version = reader.ReadFixed<uint32_t>();
+  auto seed = reader.ReadFixed<uint64_t>();
+  auto tick_rate = reader.ReadFixed<uint32_t>();
+  auto tick_count = reader.ReadFixed<uint64_t>();
+  auto world_size = reader.ReadFixed<uint32_t>();
+
+  if (reader.failed || magic != kMagic || version != kVersion || static_cast<size_t>(reader.end - reader.data) < world_size) {
+    Logger::Error("Файл \"{}\" не является записью ввода версии {}.", path, kVersion);
+    return false;
+  }
+
+  std::string world(reinterpret_cast<const char*>(reader.data), world_size);
+  reader.data += world_size;
+
+  // Обрыв данных означает, что игра завершилась аварийно во время записи: событие на обрыве
+  // отбрасывается, а запись воспроизводится до него.
+  std::vector<Event> recorded;
+  auto tick = uint64_t{0};
+  auto corrupted = false;
+  while (reader.data != reader.end) {
+    tick += reader.ReadVarint();
+    auto type = reader.ReadFixed<uint8_t>();
+
+    auto event = Event{tick, static_cast<EventType>(type), 0, 0, 0};
+    switch (event.type) {
+      case EventType::KeyDown:
+      case EventType::KeyUp:
+        event.code = static_cast<int32_t>(reader.ReadVarint());
+        break;
+      case EventType::MouseButtonDown:
+      case EventType::MouseButtonUp:
+        event.code = static_cast<int32_t>(reader.ReadVarint());
+        event.x = reader.ReadSigned();
+        event.y = reader.ReadSigned();
+        break;
+      case EventType::MouseMotion:
+      case EventType::MouseWheel:
+        event.x = reader.ReadSigned();
+        event.y = reader.ReadSigned();
+        break;
+      default:
+        corrupted = true;
+        break;
+    }
+
+    if (reader.failed || corrupted) {
+      break;
+    }
+    recorded.push_back(event);
+  }
+
+  if (corrupted) {
+    Logger::Error("Запись ввода \"{}\" повреждена.", path);
+    return false;
+  }
+
+  // События, записанные после последнего обновления заголовка, продлевают запись.
+  auto truncated = reader.failed;
+  if (!recorded.empty() && recorded.back().tick >= tick_count) {
+    tick_count = recorded.back().tick + 1;
+    truncated = true;
+  }
+  if (truncated) {
+    Logger::Warn("Запись ввода \"{}\" оборвана; воспроизводится {} тиков.", path, tick_count);
+  }
+
+  if (mode == Mode::Recording) {
+    StopRecording();
+  }
+
+  replay_events = std::move(recorded);
+  replay_cursor = 0;
+  replay_start_tick = next_tick;
+  replay_seed = seed;
+  replay_tick_rate = tick_rate;
+  replay_tick_count = tick_count;
+  replay_world = world.empty() ? std::string{} : (std::filesystem::path(path).parent_path() / world).string();
+  pending.clear();
+  mode = Mode::Replay;
+
+  Logger::Info("Воспроизведение записи ввода \"{}\": {} тиков, {} событий.", path, tick_count, replay_events.size());
+  return true;
+}
+
+void StopReplay() {
+  if (mode != Mode::Replay) {
+    return;
+  }
+
+  replay_events.clear();
+  replay_world.clear();
+  mode = Mode::Live;
+}
+
+Mode GetMode() {
+  return mode;
+}
+
+bool IsReplayFinished() {
+  return mode == Mode::Replay && next_tick - replay_start_tick >= replay_tick_count;
+}
+
+uint64_t GetReplaySeed() {
+  return replay_seed;
+}
+
+uint32_t GetReplayTickRate() {
+  return replay_tick_rate;
+}
+
+uint64_t GetReplayTickCount() {
+  return replay_tick_count;
+}
+
+const std::string& GetReplayWorld() {
+  return replay_world;
+}
+
+} // namespace gb::Input
@@ -0,0 +1,174 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_INPUT_INPUT_H
+#define GUIDING_BREEZE_SRC_CORE_INPUT_INPUT_H
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <sys/types.h>
+
+#include "SDL_events.h"
+#include "SDL_scancode.h"
+
+/**
+ * @brief Ввод игровой логики с привязкой к тикам, запись и воспроизведение.
+ *
+ * События SDL переводятся в компактные события ввода и относятся к ближайшему тику, который
+ * еще не выполнен. Логика видит события только через BeginTick, поэтому последовательность
+ * тиков и событий полностью определяет ее поведение: записанный сеанс можно воспроизвести без
+ * окна и с любой скоростью, получив тот же результат.
+ *
+ * Файл записи: заголовок {сигнатура, версия, зерно, частота тиков, количество тиков, имя снимка
+ * начального мира}, затем события {разница тиков, тип, код, x, y}, где числа записаны в формате
+ * varint (знаковые - в zigzag), а поля, не используемые типом события, пропускаются. Запись
+ * сбрасывается в файл раз в секунду вместе с количеством тиков, поэтому запись, оборванную
+ * аварийным завершением игры, тоже можно воспроизвести.
+ *
+ * @note Взаимодействие с интерфейсом ImGui не записывается; в запись попадает только ввод,
+ * который интерфейс не перехватил.
+ */
+namespace gb::Input {
+
+/**
+ * @brief Тип события ввода.
+ */
+enum class EventType : u_short {
+  KeyDown,         //< Нажатие клавиши; code - SDL_Scancode
+  KeyUp,           //< Отпускание клавиши; code - SDL_Scancode
+  MouseMotion,     //< Перемещение мыши; x, y - положение в окне
+  MouseButtonDown, //< Нажатие кнопки мыши; code - номер кнопки, x, y - положение
+  MouseButtonUp,   //< Отпускание кнопки мыши; code - номер кнопки, x, y - положение
+  MouseWheel       //< Прокрутка колеса; x, y - величина прокрутки
+};
+
+/**
+ * @brief Событие ввода, отнесенное к тику.
+ */
+struct Event {
+  uint64_t tick;  //< Тик, в начале которого событие становится видимым логике
+  EventType type; //< Тип события
+  int32_t code;   //< Клавиша или кнопка
+  int32_t x;      //< Координата X или прокрутка по горизонтали
+  int32_t y;      //< Координата Y или прокрутка по вертикали
+};
+
+/**
+ * @brief Режим источника ввода.
+ */
+enum class Mode : u_short {
+  Live,      //< События поступают из SDL
+  Recording, //< События поступают из SDL и записываются в файл
+  Replay     //< События читаются из записи; события SDL игнорируются
+};
+
+/**
+ * @brief Передать событие SDL.
+ *
+ * @param event Событие; неигровые события и события во время воспроизведения пропускаются.
+ */
+void Push(const SDL_Event& event);
+
+/**
+ * @brief Начать очередной тик: выдать логике относящиеся к нему события и обновить состояние.
+ *
+ * @note Вызывается в начале каждого тика логики, до обновления систем.
+ */
+void BeginTick();
+
+/**
+ * @brief Получить события текущего тика.
+ *
+ * @return std::span<const Event> События; действительны до следующего BeginTick.
+ */
+[[nodiscard]] std::span<const Event> GetEvents();
+
+/**
+ * @brief Проверить, нажата ли клавиша в текущем тике.
+ */
+[[nodiscard]] bool IsKeyDown(SDL_Scancode scancode);
+
+/**
+ * @brief Проверить, нажата ли кнопка мыши в текущем тике.
+ *
+ * @param button Номер кнопки SDL_BUTTON_*.
+ */
+[[nodiscard]] bool IsMouseButtonDown(int32_t button);
+
+/**
+ * @brief Получить положение мыши в текущем тике.
+ */
+void GetMousePosition(int32_t& x, int32_t& y);
+
+/**
+ * @brief Получить количество начатых тиков.
+ */
+[[nodiscard]] uint64_t GetTick();
+
+/**
+ * @brief Начать запись ввода в файл.
+ *
+ * @param path Путь к файлу.
+ * @param seed Зерно генератора случайных чисел логики; сохраняется в заголовке.
+ * @param tick_rate Частота тиков; сохраняется для проверки при воспроизведении.
+ * @param world Путь к снимку мира, сохраненному перед началом записи; в заголовок попадает только
+ * имя файла, поэтому снимок должен лежать рядом с записью. Пустой - запись без начального мира.
+ * @return true Если файл создан.
+ * @note Генератор случайных чисел логики должен быть засеян seed в тот же тик, иначе
+ * воспроизведение начнется с другого его состояния.
+ */
+bool StartRecording(const std::string& path, uint64_t seed, uint32_t tick_rate, const std::string& world = {});
+
+/**
+ * @brief Завершить запись и дописать в заголовок окончательное количество тиков.
+ *
+ * @return true Если запись полностью сохранена.
+ */
+bool StopRecording();
+
+/**
+ * @brief Начать воспроизведение записи со следующего тика.
+ *
+ * @param path Путь к файлу.
+ * @return true Если запись прочитана; иначе режим не меняется.
+ */
+bool StartReplay(const std::string& path);
+
+/**
+ * @brief Прекратить воспроизведение и вернуться к вводу из SDL.
+ */
+void StopReplay();
+
+/**
+ * @brief Получить текущий режим.
+ */
+[[nodiscard]] Mode GetMode();
+
+/**
+ * @brief Проверить, выданы ли все тики воспроизводимой записи.
+ */
+[[nodiscard]] bool IsReplayFinished();
+
+/**
+ * @brief Получить зерно воспроизводимой записи.
+ */
+[[nodiscard]] uint64_t GetReplaySeed();
+
+/**
+ * @brief Получить частоту тиков воспроизводимой записи.
+ */
+[[nodiscard]] uint32_t GetReplayTickRate();
+
+/**
+ * @brief Получить количество тиков воспроизводимой записи.
+ */
+[[nodiscard]] uint64_t GetReplayTickCount();
+
+/**
+ * @brief Получить путь к снимку начального мира воспроизводимой записи.
+ *
+ * @return const std::string& Путь рядом с записью; пустой, если мир не сохранялся.
+ */
+[[nodiscard]] const std::string& GetReplayWorld();
+
+} // namespace gb::Input
+
+#endif // GUIDING_BREEZE_SRC_CORE_INPUT_INPUT_H
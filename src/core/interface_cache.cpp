@@ -0,0 +1,190 @@
+#include "interface_cache.hpp"
+
+#include "logger/logger.hpp"
+#include "profiler/profiler.hpp"
+
+#include "SDL_blendmode.h"
+#include "SDL_error.h"
+#include "SDL_pixels.h"
+#include "imgui_impl_sdlrenderer2.h"
+
+namespace gb {
+
+namespace {
+
+  constexpr uint32_t kSettleFrames = 3; //< Сколько кадров перестраивать интерфейс после ввода
+
+} // namespace
+
+InterfaceCache::~InterfaceCache() noexcept {
+  DestroyTexture();
+}
+
+void InterfaceCache::SetRenderer(SDL_Renderer* renderer) {
+  DestroyTexture();
+  renderer_ = renderer;
+  Invalidate();
+}
+
+void InterfaceCache::SetEnabled(bool enabled) {
+  enabled_ = enabled;
+  texture_valid_ = false;
+  Invalidate();
+
+  if (!enabled_) {
+    DestroyTexture();
+  }
+}
+
+bool InterfaceCache::IsEnabled() const {
+  return enabled_;
+}
+
+void InterfaceCache::SetRebuildRate(uint32_t rate) {
+  rebuild_rate_ = rate;
+}
+
+uint32_t InterfaceCache::GetRebuildRate() const {
+  return rebuild_rate_;
+}
+
+void InterfaceCache::HandleEvent(const SDL_Event& event) {
+  switch (event.type) {
+    case SDL_RENDER_TARGETS_RESET:
+    case SDL_RENDER_DEVICE_RESET:
+      // Содержимое текстур-целей потеряно вместе с устройством
+      texture_valid_ = false;
+      Invalidate();
+      break;
+    case SDL_KEYDOWN:
+    case SDL_KEYUP:
+    case SDL_TEXTEDITING:
+    case SDL_TEXTINPUT:
+    case SDL_MOUSEMOTION:
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+    case SDL_MOUSEWHEEL:
+    case SDL_WINDOWEVENT:
+      Invalidate();
+      break;
+    default:
+      break;
+  }
+}
+
+void InterfaceCache::Invalidate() {
+  dirty_ = true;
+}
+
+bool InterfaceCache::BeginFrame() {
+  auto now = Clock::now();
+  auto interval = rebuild_rate_ > 0 ? std::chrono::duration<double>(1.0 / rebuild_rate_) : std::chrono::duration<double>(0.0);
+
+  // Поле ввода перестраивается каждый кадр, иначе курсор перестает мигать
+  rebuilt_ = !enabled_ || dirty_ || settle_frames_ > 0 || ImGui::GetIO().WantTextInput || now - last_rebuild_ >= interval;
+
+  if (dirty_) {
+    settle_frames_ = kSettleFrames;
+  } else if (settle_frames_ > 0) {
+    settle_frames_--;
+  }
+  dirty_ = false;
+
+  stats_.frames++;
+  if (rebuilt_) {
+    last_rebuild_ = now;
+    stats_.rebuilds++;
+  }
+
+  return rebuilt_;
+}
+
+void InterfaceCache::Draw(ImDrawData* draw_data) {
+  GB_PROFILE_ZONE("Вывод интерфейса");
+
+  if (!enabled_ || !PrepareTexture()) {
+    ImGui_ImplSDLRenderer2_RenderDrawData(draw_data, renderer_);
+    return;
+  }
+
+  // Текстура перерисовывается и после потери содержимого: данные прошлого ImGui::Render еще действительны
+  if (rebuilt_ || !texture_valid_) {
+    SDL_SetRenderTarget(renderer_, texture_);
+    SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 0);
+    SDL_RenderClear(renderer_);
+    ImGui_ImplSDLRenderer2_RenderDrawData(draw_data, renderer_);
+    SDL_SetRenderTarget(renderer_, nullptr);
+
+    texture_valid_ = true;
+    stats_.uploads++;
+  }
+
+  SDL_RenderCopy(renderer_, texture_, nullptr, nullptr);
+}
+
+const InterfaceCache::Stats& InterfaceCache::GetStats() const {
+  return stats_;
+}
+
+void InterfaceCache::ResetStats() {
+  stats_ = Stats{};
+}
+
+bool InterfaceCache::PrepareTexture() {
+  if (!renderer_) {
+    return false;
+  }
+
+  int width = 0;
+  int height = 0;
+  SDL_GetRendererOutputSize(renderer_, &width, &height);
+
+  if (texture_ && width == texture_width_ && height == texture_height_) {
+    return true;
+  }
+
+  DestroyTexture();
+
+  if (!SDL_RenderTargetSupported(renderer_)) {
+    Logger::Warn("Отрисовщик не поддерживает текстуры-цели, кэш интерфейса выключен.");
+    enabled_ = false;
+    return false;
+  }
+
+  texture_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+  if (!texture_) {
+    Logger::Warn("Не удалось создать текстуру кэша интерфейса: {}", SDL_GetError());
+    enabled_ = false;
+    return false;
+  }
+
+  // Смешивание при отрисовке ImGui в прозрачную текстуру дает цвет, уже умноженный на альфу,
+  // поэтому при выводе текстуры цвет источника берется без повторного умножения.
+  auto premultiplied = SDL_ComposeCustomBlendMode(
+    SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, SDL_BLENDFACTOR_ONE,
+    SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD
+  );
+  if (SDL_SetTextureBlendMode(texture_, premultiplied) != 0) {
+    Logger::Warn("Отрисовщик не поддерживает смешивание с предумноженной альфой, кэш интерфейса выключен.");
+    DestroyTexture();
+    enabled_ = false;
+    return false;
+  }
+
+  texture_width_ = width;
+  texture_height_ = height;
+  return true;
+}
+
+void InterfaceCache::DestroyTexture() {
+  if (texture_) {
+    SDL_DestroyTexture(texture_);
+    texture_ = nullptr;
+  }
+
+  texture_width_ = 0;
+  texture_height_ = 0;
+  texture_valid_ = false;
+}
+
+} // namespace gb
@@ -0,0 +1,125 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_INTERFACE_CACHE_H
+#define GUIDING_BREEZE_SRC_CORE_INTERFACE_CACHE_H
+
+#include <chrono>
+#include <cstdint>
+
+#include "SDL_events.h"
+#include "SDL_render.h"
+#include "imgui.h"
+
+namespace gb {
+
+/**
+ * @brief Кэш кадра интерфейса ImGui.
+ *
+ * Без кэша интерфейс строится и отправляется в отрисовщик каждый кадр. С кэшем он перестраивается,
+ * только когда пришел ввод, кто-то вызвал Invalidate или прошел интервал обновления (чтобы живая
+ * статистика все-таки менялась). Построенный интерфейс рисуется в текстуру-цель, а в кадрах
+ * без перестроения выводится только эта текстура: ни построения окон, ни отправки геометрии ImGui.
+ *
+ * После ввода интерфейс перестраивается еще несколько кадров подряд: подсветка и раскрытие
+ * элементов ImGui применяются на кадр позже события.
+ *
+ * @note Если отрисовщик не поддерживает текстуры-цели или смешивание с предумноженной альфой,
+ * кэш выключается и интерфейс рисуется как обычно.
+ */
+class InterfaceCache final {
+public:
+  /**
+   * @brief Статистика кэша с последнего сброса.
+   */
+  struct Stats {
+    uint64_t frames{0};   //< Количество кадров
+    uint64_t rebuilds{0}; //< Количество кадров, в которых интерфейс строился заново
+    uint64_t uploads{0};  //< Количество отрисовок интерфейса в текстуру-цель
+  };
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+private:
+  SDL_Renderer* renderer_{nullptr};   //< Отрисовщик
+  SDL_Texture* texture_{nullptr};     //< Текстура-цель с последним построенным интерфейсом
+  int texture_width_{0};              //< Ширина текстуры-цели
+  int texture_height_{0};             //< Высота текстуры-цели
+  bool texture_valid_{false};         //< Совпадает ли содержимое текстуры с последним построенным интерфейсом
+  bool enabled_{false};               //< Включен ли кэш
+  uint32_t rebuild_rate_{10};         //< Частота перестроения без ввода; 0 - каждый кадр
+  bool dirty_{true};                  //< Интерфейс нужно перестроить в следующем кадре
+  uint32_t settle_frames_{0};         //< Сколько еще кадров перестраивать после ввода
+  bool rebuilt_{true};                //< Перестроен ли интерфейс в текущем кадре
+  Clock::time_point last_rebuild_{};  //< Время последнего перестроения
+  Stats stats_;                       //< Статистика
+
+public:
+  InterfaceCache() = default;
+  InterfaceCache(const InterfaceCache&) = delete;
+  InterfaceCache(InterfaceCache&&) = delete;
+  ~InterfaceCache() noexcept;
+
+public:
+  InterfaceCache& operator=(const InterfaceCache&) = delete;
+  InterfaceCache& operator=(InterfaceCache&&) = delete;
+
+public:
+  /**
+   * @brief Задать отрисовщик, в котором создается текстура-цель.
+   *
+   * @param renderer Отрисовщик; nullptr освобождает текстуру перед уничтожением отрисовщика.
+   */
+  void SetRenderer(SDL_Renderer* renderer);
+
+  /**
+   * @brief Включить или выключить кэш.
+   */
+  void SetEnabled(bool enabled);
+
+  [[nodiscard]] bool IsEnabled() const;
+
+  /**
+   * @brief Задать частоту перестроения интерфейса, пока нет ввода.
+   *
+   * @param rate Перестроений в секунду; 0 - каждый кадр.
+   */
+  void SetRebuildRate(uint32_t rate);
+
+  [[nodiscard]] uint32_t GetRebuildRate() const;
+
+  /**
+   * @brief Учесть событие SDL: ввод и события окна требуют перестроить интерфейс.
+   */
+  void HandleEvent(const SDL_Event& event);
+
+  /**
+   * @brief Перестроить интерфейс в следующем кадре, например после смены шрифта или режима экрана.
+   */
+  void Invalidate();
+
+  /**
+   * @brief Начать кадр.
+   *
+   * @return true Если интерфейс нужно построить заново: вызвать NewFrame, построить окна и ImGui::Render.
+   * @return false Если выводится прошлый интерфейс и кадр ImGui пропускается.
+   */
+  [[nodiscard]] bool BeginFrame();
+
+  /**
+   * @brief Вывести интерфейс поверх кадра.
+   *
+   * @param draw_data Данные последнего ImGui::Render; при пропуске кадра ImGui остаются действительными.
+   */
+  void Draw(ImDrawData* draw_data);
+
+  [[nodiscard]] const Stats& GetStats() const;
+
+  void ResetStats();
+
+private:
+  [[nodiscard]] bool PrepareTexture();
+  void DestroyTexture();
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_INTERFACE_CACHE_H
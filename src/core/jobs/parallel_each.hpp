@@ -0,0 +1,205 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_JOBS_PARALLEL_EACH_H
+#define GUIDING_BREEZE_SRC_CORE_JOBS_PARALLEL_EACH_H
+
+#include "core/jobs/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace gb {
+
+namespace detail {
+
+  constexpr size_t kCacheLineSize = 64; //< Размер кэш-линии в байтах
+  constexpr size_t kChunksPerThread = 4; //< Количество фрагментов на поток при автоматическом выборе размера
+  constexpr size_t kReduceChunks = 64; //< Количество фрагментов свертки при автоматическом выборе размера
+
+  /**
+   * @brief Подобрать размер фрагмента, занимающий в ведущем хранилище целое число кэш-линий.
+   *
+   * @tparam Component Тип ведущего компонента.
+   * @param size Количество сущностей в ведущем хранилище.
+   * @param concurrency Количество потоков, выполняющих фрагменты.
+   * @param grain Запрошенный размер фрагмента; 0 - выбрать автоматически.
+   * @return size_t Размер фрагмента в сущностях.
+   */
+  template<typename Component>
+  [[nodiscard]] size_t ChunkSize(size_t size, size_t concurrency, size_t grain) {
+    constexpr auto kPerLine = kCacheLineSize / std::gcd(kCacheLineSize, sizeof(Component));
+
+    if (grain == 0) {
+      grain = (size + concurrency * kChunksPerThread - 1) / (concurrency * kChunksPerThread);
+    }
+
+    // Смещения границ фрагментов от начала страницы хранилища кратны кэш-линии. Сама страница
+    // выровнена только по alignof(Component), поэтому соседние фрагменты могут делить одну линию
+    // на границе; ложное разделение не исключается, а ограничивается линией на границу фрагмента.
+    // Прочие хранилища перебираются в порядке ведущего, и для них ограничения нет.
+    return std::max(kPerLine, (grain + kPerLine - 1) / kPerLine * kPerLine);
+  }
+
+  /**
+   * @brief Выполнить функцию для каждого фрагмента в пуле потоков и дождаться завершения.
+   *
+   * @param pool Пул потоков.
+   * @param chunk_count Количество фрагментов.
+   * @param func Функция вида void(size_t chunk).
+   */
+  template<typename Func>
+  void RunChunks(ThreadPool& pool, size_t chunk_count, Func& func) {
+    if (chunk_count <= 1) {
+      if (chunk_count == 1) {
+        func(size_t{0});
+      }
+      return;
+    }
+
+    // Задачи захватывают только общее задание и номер фрагмента, чтобы std::function
+    // не выделял под них память.
+    struct Job {
+      Func* func;
+      std::atomic<size_t> unfinished;
+    };
+    Job job{&func, chunk_count};
+
+    for (auto chunk = size_t{0}; chunk < chunk_count; chunk++) {
+      pool.Submit([&job, chunk] {
+        (*job.func)(chunk);
+        job.unfinished.fetch_sub(1, std::memory_order_acq_rel);
+      });
+    }
+
+    pool.WaitUntil([&job] { return job.unfinished.load(std::memory_order_acquire) == 0; });
+  }
+
+} // namespace detail
+
+/**
+ * @brief Параллельно вызвать функцию для всех сущностей с заданными компонентами.
+ *
+ * Упакованный массив хранилища первого компонента делится на фрагменты размером в целое
+ * число кэш-линий, которые распределяются по пулу потоков.
+ *
+ * @tparam Components Типы компонентов; первый определяет перебираемое хранилище,
+ * поэтому первым лучше указывать самый редкий компонент.
+ * @param pool Пул потоков.
+ * @param registry Реестр сущностей.
+ * @param func Функция вида void(Components&...) или void(entt::entity, Components&...).
+ * @param grain Размер фрагмента в сущностях; 0 - выбрать автоматически.
+ * @note Функция не должна изменять структуру реестра; структурные изменения записываются в CommandBuffer.
+ */
+template<typename... Components, typename Func>
+void ParallelEach(ThreadPool& pool, entt::registry& registry, Func&& func, size_t grain = 0) {
+  using Lead = std::remove_const_t<std::tuple_element_t<0, std::tuple<Components...>>>;
+
+  auto view = registry.view<Components...>();
+  const auto& lead = registry.storage<Lead>();
+  const auto* entities = lead.data();
+  auto size = lead.size();
+
+  auto chunk_size = detail::ChunkSize<Lead>(size, pool.GetConcurrency(), grain);
+  auto chunk_count = (size + chunk_size - 1) / chunk_size;
+
+  auto run_chunk = [&](size_t chunk) {
+    auto end = std::min(size, (chunk + 1) * chunk_size);
+
+    for (auto i = chunk * chunk_size; i < end; i++) {
+      auto entity = entities[i];
+
+      if constexpr (sizeof...(Components) > 1) {
+        if (!view.contains(entity)) {
+          continue;
+        }
+      }
+
+      if constexpr (std::is_invocable_v<Func&, entt::entity, Components&...>) {
+        func(entity, view.template get<Components>(entity)...);
+      } else {
+        func(view.template get<Components>(entity)...);
+      }
+    }
+  };
+
+  detail::RunChunks(pool, chunk_count, run_chunk);
+}
+
+/**
+ * @brief Параллельно свернуть значения для всех сущностей с заданными компонентами.
+ *
+ * Каждый фрагмент накапливает результат в собственном аккумуляторе (рабочей памяти потока),
+ * после чего аккумуляторы объединяются строго в порядке фрагментов. Границы фрагментов
+ * не зависят от количества потоков, поэтому результат, в том числе для чисел с плавающей
+ * точкой, не зависит ни от количества потоков, ни от порядка их выполнения.
+ *
+ * @tparam Components Типы компонентов; первый определяет перебираемое хранилище.
+ * @param pool Пул потоков.
+ * @param registry Реестр сущностей.
+ * @param init Начальное значение каждого аккумулятора; должно быть нейтральным элементом для combine.
+ * @param func Функция вида void(Result& accumulator, Components&...).
+ * @param combine Функция вида void(Result& target, const Result& source).
+ * @param grain Размер фрагмента в сущностях; 0 - выбрать автоматически.
+ * @return Result Свернутое значение.
+ */
+template<typename... Components, typename Result, typename Func, typename Combine>
+Result ParallelReduce(
+  ThreadPool& pool, entt::registry& registry, const Result& init, Func&& func, Combine&& combine,
+  size_t grain = 0
+) {
+  using Lead = std::remove_const_t<std::tuple_element_t<0, std::tuple<Components...>>>;
+
+  auto view = registry.view<Components...>();
+  const auto& lead = registry.storage<Lead>();
+  const auto* entities = lead.data();
+  auto size = lead.size();
+
+  // Размер фрагмента выбирается по размеру хранилища, а не по количеству потоков.
+  if (grain == 0) {
+    grain = std::max(size_t{1}, (size + detail::kReduceChunks - 1) / detail::kReduceChunks);
+  }
+
+  auto chunk_size = detail::ChunkSize<Lead>(size, pool.GetConcurrency(), grain);
+  auto chunk_count = (size + chunk_size - 1) / chunk_size;
+
+  // Аккумуляторы выровнены по кэш-линиям, чтобы соседние фрагменты не делили линии.
+  struct alignas(detail::kCacheLineSize) Partial {
+    Result value;
+  };
+  std::vector<Partial> partials(chunk_count, Partial{init});
+
+  auto run_chunk = [&](size_t chunk) {
+    auto& accumulator = partials[chunk].value;
+    auto end = std::min(size, (chunk + 1) * chunk_size);
+
+    for (auto i = chunk * chunk_size; i < end; i++) {
+      auto entity = entities[i];
+
+      if constexpr (sizeof...(Components) > 1) {
+        if (!view.contains(entity)) {
+          continue;
+        }
+      }
+
+      func(accumulator, view.template get<Components>(entity)...);
+    }
+  };
+
+  detail::RunChunks(pool, chunk_count, run_chunk);
+
+  auto result = init;
+  for (const auto& partial : partials) {
+    combine(result, partial.value);
+  }
+
+  return result;
+}
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_JOBS_PARALLEL_EACH_H
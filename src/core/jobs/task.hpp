@@ -0,0 +1,172 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_JOBS_TASK_H
+#define GUIDING_BREEZE_SRC_CORE_JOBS_TASK_H
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace gb {
+
+template<typename T>
+class Task;
+
+namespace detail {
+
+  /**
+   * @brief Общая часть обещания задачи: продолжение и исключение.
+   */
+  class TaskPromiseBase {
+  private:
+    /**
+     * @brief Ожидание завершения: управление передается ожидающей сопрограмме без роста стека.
+     */
+    struct FinalAwaiter {
+      [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+      }
+
+      template<typename Promise>
+      [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept {
+        auto continuation = handle.promise().continuation_;
+        return continuation ? continuation : std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept {
+      }
+    };
+
+  private:
+    std::coroutine_handle<> continuation_; //< Сопрограмма, ожидающая задачу
+    std::exception_ptr exception_;         //< Исключение, вышедшее из задачи
+
+  public:
+    [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+      return {};
+    }
+
+    [[nodiscard]] FinalAwaiter final_suspend() const noexcept {
+      return {};
+    }
+
+    void unhandled_exception() noexcept {
+      exception_ = std::current_exception();
+    }
+
+    void SetContinuation(std::coroutine_handle<> continuation) {
+      continuation_ = continuation;
+    }
+
+    void RethrowIfFailed() const {
+      if (exception_) {
+        std::rethrow_exception(exception_);
+      }
+    }
+  };
+
+  template<typename T>
+  class TaskPromise final : public TaskPromiseBase {
+  private:
+    std::optional<T> value_; //< Результат задачи
+
+  public:
+    [[nodiscard]] Task<T> get_return_object() noexcept;
+
+    template<typename U>
+    void return_value(U&& value) {
+      value_.emplace(std::forward<U>(value));
+    }
+
+    [[nodiscard]] T TakeValue() {
+      RethrowIfFailed();
+      return std::move(*value_);
+    }
+  };
+
+  template<>
+  class TaskPromise<void> final : public TaskPromiseBase {
+  public:
+    [[nodiscard]] Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {
+    }
+
+    void TakeValue() const {
+      RethrowIfFailed();
+    }
+  };
+
+} // namespace detail
+
+/**
+ * @brief Ленивая сопрограмма, возвращающая значение типа T.
+ *
+ * Задача начинает выполняться, только когда ее ожидают через co_await: тогда она выполняется
+ * в том же потоке, что и ожидающая сопрограмма, а по завершении сразу возобновляет ее.
+ * Перенести выполнение в другой поток, на следующий тик или в поток логики можно изнутри
+ * задачи ожиданиями TaskScheduler; запустить задачу независимо от вызывающего - через
+ * TaskScheduler::Launch.
+ *
+ * @tparam T Тип результата; void - задача без результата.
+ * @note Исключение из задачи повторно выбрасывается в ожидающей сопрограмме.
+ */
+template<typename T = void>
+class [[nodiscard]] Task final {
+public:
+  using promise_type = detail::TaskPromise<T>;
+
+private:
+  std::coroutine_handle<promise_type> handle_;
+
+public:
+  explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {
+  }
+
+  Task(const Task&) = delete;
+
+  Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {
+  }
+
+  ~Task() noexcept {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+public:
+  Task& operator=(const Task&) = delete;
+  Task& operator=(Task&&) = delete;
+
+public:
+  [[nodiscard]] bool await_ready() const noexcept {
+    return false;
+  }
+
+  [[nodiscard]] std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+    assert(handle_);
+    handle_.promise().SetContinuation(awaiting);
+    return handle_;
+  }
+
+  T await_resume() {
+    return handle_.promise().TakeValue();
+  }
+};
+
+namespace detail {
+
+  template<typename T>
+  Task<T> TaskPromise<T>::get_return_object() noexcept {
+    return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+  }
+
+  inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+  }
+
+} // namespace detail
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_JOBS_TASK_H
@@ -0,0 +1,278 @@
+#include "task_scheduler.hpp"
+
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace gb {
+
+namespace {
+
+  /**
+   * @brief Задача, которая выполняется в текущем потоке.
+   */
+  struct Context {
+    detail::TaskRoot* root{nullptr};                   //< Задача верхнего уровня
+    TaskPriority priority{TaskPriority::Normal};       //< Ее приоритет
+    std::chrono::steady_clock::time_point slice_begin; //< Начало отрезка времени для Yield
+    bool main{false};                                  //< Выполняется в потоке логики из Update
+  };
+
+  thread_local Context current_context; //< Контекст текущего потока
+
+} // namespace
+
+void TaskScheduler::BackgroundAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+  scheduler_->Post(Entry{handle, current_context.root, priority_});
+}
+
+void TaskScheduler::NextTickAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+  std::lock_guard lock(scheduler_->mutex_);
+  scheduler_->next_tick_.push_back(Entry{handle, current_context.root, current_context.priority});
+}
+
+bool TaskScheduler::MainThreadAwaiter::await_ready() const noexcept {
+  return current_context.main;
+}
+
+void TaskScheduler::MainThreadAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+  std::lock_guard lock(scheduler_->mutex_);
+  scheduler_->main_queue_.push_back(Entry{handle, current_context.root, current_context.priority});
+}
+
+bool TaskScheduler::YieldAwaiter::await_ready() const noexcept {
+  return Clock::now() - current_context.slice_begin < scheduler_->slice_;
+}
+
+void TaskScheduler::YieldAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+  Entry entry{handle, current_context.root, current_context.priority};
+
+  // Продолжение встает в конец своей очереди: сначала выполнятся те, кто ждал дольше.
+  if (current_context.main) {
+    std::lock_guard lock(scheduler_->mutex_);
+    scheduler_->main_queue_.push_back(entry);
+  } else {
+    scheduler_->Post(entry);
+  }
+}
+
+TaskScheduler::TaskScheduler(ThreadPool* pool) : pool_(pool) {
+  assert(pool);
+}
+
+TaskScheduler::~TaskScheduler() noexcept {
+  stopping_.store(true, std::memory_order_release);
+  pool_->WaitUntil([this] { return posted_.load(std::memory_order_acquire) == 0; });
+
+  // Ни одна задача больше не выполняется: все приостановленные лежат в очередях.
+  {
+    std::lock_guard lock(mutex_);
+    for (auto& [root, owned] : roots_) {
+      owned->state->cancelled.store(true, std::memory_order_release);
+    }
+  }
+
+  static_cast<void>(Purge());
+  assert(roots_.empty());
+}
+
+void TaskScheduler::Update() {
+  GB_PROFILE_ZONE("Задачи");
+  auto start = Clock::now();
+
+  {
+    std::lock_guard lock(mutex_);
+    main_queue_.insert(main_queue_.end(), next_tick_.begin(), next_tick_.end());
+    next_tick_.clear();
+  }
+
+  // Продолжения сверх бюджета остаются в очереди до следующего тика.
+  for (;;) {
+    Entry entry;
+    {
+      std::lock_guard lock(mutex_);
+      if (main_queue_.empty()) {
+        break;
+      }
+
+      entry = main_queue_.front();
+      main_queue_.pop_front();
+    }
+
+    Resume(entry, true);
+
+    if (Clock::now() - start >= main_budget_) {
+      break;
+    }
+  }
+
+  std::lock_guard lock(mutex_);
+  stats_.update_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void TaskScheduler::Cancel(const void* owner) {
+  auto has_roots = [this, owner] {
+    std::lock_guard lock(mutex_);
+    return std::any_of(roots_.begin(), roots_.end(), [owner](const auto& root) {
+      return root.second->owner == owner;
+    });
+  };
+
+  {
+    std::lock_guard lock(mutex_);
+    for (auto& [root, owned] : roots_) {
+      if (owned->owner == owner) {
+        owned->state->cancelled.store(true, std::memory_order_release);
+      }
+    }
+  }
+
+  // Выполняющиеся задачи уничтожаются, когда их продолжение попадет в очередь.
+  while (Purge() > 0 || has_roots()) {
+    if (!pool_->RunPendingTask()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void TaskScheduler::SetMainBudget(Clock::duration budget) {
+  main_budget_ = budget;
+}
+
+void TaskScheduler::SetSlice(Clock::duration slice) {
+  slice_ = slice;
+}
+
+TaskScheduler::Stats TaskScheduler::GetStats() {
+  std::lock_guard lock(mutex_);
+  auto stats = stats_;
+  stats.active = roots_.size();
+  stats.queued = main_queue_.size() + next_tick_.size();
+  for (const auto& queue : background_) {
+    stats.queued += queue.size();
+  }
+  return stats;
+}
+
+bool TaskScheduler::IsInBackground() {
+  return current_context.root && !current_context.main;
+}
+
+void TaskScheduler::Start(
+  std::coroutine_handle<RootTask::promise_type> handle, std::shared_ptr<detail::TaskStateBase> state,
+  TaskPriority priority, const void* owner
+) {
+  auto root = std::make_unique<detail::TaskRoot>();
+  root->handle = handle;
+  root->owner = owner;
+  root->state = std::move(state);
+
+  handle.promise().scheduler = this;
+  handle.promise().root = root.get();
+
+  auto* entry_root = root.get();
+  {
+    std::lock_guard lock(mutex_);
+    roots_.emplace(entry_root, std::move(root));
+    stats_.launched++;
+  }
+
+  Post(Entry{handle, entry_root, priority});
+}
+
+void TaskScheduler::Unregister(const detail::TaskRoot* root) {
+  std::lock_guard lock(mutex_);
+  auto it = roots_.find(root);
+  assert(it != roots_.end());
+
+  const auto& state = *it->second->state;
+  if (state.cancelled.load(std::memory_order_acquire) && !state.ready.load(std::memory_order_acquire)) {
+    stats_.cancelled++;
+  } else {
+    stats_.completed++;
+  }
+  roots_.erase(it);
+}
+
+void TaskScheduler::Post(Entry entry) {
+  {
+    std::lock_guard lock(mutex_);
+    background_[static_cast<size_t>(entry.priority)].push_back(entry);
+  }
+
+  // Каждое продолжение сопровождается одной выборкой в пуле; выборка берет самое приоритетное.
+  posted_.fetch_add(1, std::memory_order_relaxed);
+  pool_->Submit([this] { Drain(); });
+}
+
+void TaskScheduler::Drain() {
+  Entry entry;
+  auto found = false;
+
+  {
+    std::lock_guard lock(mutex_);
+    if (!stopping_.load(std::memory_order_acquire)) {
+      for (auto& queue : background_) {
+        if (!queue.empty()) {
+          entry = queue.front();
+          queue.pop_front();
+          found = true;
+          break;
+        }
+      }
+    }
+  }
+
+  if (found) {
+    Resume(entry, false);
+  }
+
+  // Последнее обращение к планировщику: после него деструктор может завершиться.
+  posted_.fetch_sub(1, std::memory_order_release);
+}
+
+void TaskScheduler::Resume(const Entry& entry, bool main) {
+  if (entry.root->state->cancelled.load(std::memory_order_acquire)) {
+    entry.root->handle.destroy();
+    return;
+  }
+
+  // Сопрограмма может ждать пул изнутри другой сопрограммы, поэтому контекст восстанавливается.
+  auto previous = current_context;
+  current_context = Context{entry.root, entry.priority, Clock::now(), main};
+  entry.handle.resume();
+  current_context = previous;
+}
+
+size_t TaskScheduler::Purge() {
+  std::vector<detail::TaskRoot*> cancelled;
+
+  {
+    std::lock_guard lock(mutex_);
+    auto extract = [&cancelled](auto& queue) {
+      auto it = std::stable_partition(queue.begin(), queue.end(), [](const Entry& entry) {
+        return !entry.root->state->cancelled.load(std::memory_order_acquire);
+      });
+      for (auto removed = it; removed != queue.end(); ++removed) {
+        cancelled.push_back(removed->root);
+      }
+      queue.erase(it, queue.end());
+    };
+
+    for (auto& queue : background_) {
+      extract(queue);
+    }
+    extract(main_queue_);
+    extract(next_tick_);
+  }
+
+  // Уничтожение сопрограммы снимает задачу с учета, поэтому выполняется без блокировки.
+  for (auto* root : cancelled) {
+    root->handle.destroy();
+  }
+
+  return cancelled.size();
+}
+
+} // namespace gb
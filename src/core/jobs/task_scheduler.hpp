@@ -0,0 +1,428 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_JOBS_TASK_SCHEDULER_H
+#define GUIDING_BREEZE_SRC_CORE_JOBS_TASK_SCHEDULER_H
+
+#include <sys/types.h>
+
+#include "core/jobs/task.hpp"
+#include "core/jobs/thread_pool.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gb {
+
+/**
+ * @brief Приоритет задачи в пуле потоков.
+ */
+enum class TaskPriority : u_short {
+  High,   //< Нужна в ближайшие кадры: например, поиск пути для видимого персонажа
+  Normal, //< Обычная фоновая работа
+  Low,    //< Может ждать: генерация и распаковка впрок
+};
+
+constexpr size_t kTaskPriorityCount = 3;
+
+namespace detail {
+
+  /**
+   * @brief Общее состояние запущенной задачи и ее дескриптора.
+   */
+  struct TaskStateBase {
+    std::atomic<bool> ready{false};     //< Задача завершилась, результат или исключение записаны
+    std::atomic<bool> cancelled{false}; //< Задача отменена и не завершится
+    std::exception_ptr exception;       //< Исключение, вышедшее из задачи
+  };
+
+  template<typename T>
+  struct TaskState final : TaskStateBase {
+    std::optional<T> value; //< Результат задачи
+  };
+
+  template<>
+  struct TaskState<void> final : TaskStateBase {};
+
+  /**
+   * @brief Запущенная задача верхнего уровня.
+   */
+  struct TaskRoot {
+    std::coroutine_handle<> handle;       //< Сопрограмма-обертка задачи
+    const void* owner{nullptr};           //< Владелец для отмены (например, система)
+    std::shared_ptr<TaskStateBase> state; //< Состояние, общее с дескриптором
+  };
+
+} // namespace detail
+
+/**
+ * @brief Дескриптор запущенной задачи, через который результат забирается в следующих тиках.
+ *
+ * @tparam T Тип результата задачи.
+ * @note Дескриптор не продлевает жизнь задачи: без него задача все равно выполнится до конца.
+ */
+template<typename T = void>
+class TaskHandle final {
+private:
+  std::shared_ptr<detail::TaskState<T>> state_;
+
+public:
+  TaskHandle() = default;
+
+  explicit TaskHandle(std::shared_ptr<detail::TaskState<T>> state) : state_(std::move(state)) {
+  }
+
+public:
+  [[nodiscard]] bool IsValid() const {
+    return state_ != nullptr;
+  }
+
+  /**
+   * @brief Проверить, завершилась ли задача.
+   *
+   * @return true Если результат можно забрать через Get без ожидания.
+   */
+  [[nodiscard]] bool IsReady() const {
+    return state_ && state_->ready.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Проверить, отменена ли задача вместе с ее владельцем.
+   */
+  [[nodiscard]] bool IsCancelled() const {
+    return state_ && state_->cancelled.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Забрать результат завершенной задачи; дескриптор становится пустым.
+   *
+   * @return T Результат; исключение задачи выбрасывается повторно.
+   */
+  T Get() {
+    assert(IsReady());
+    auto state = std::move(state_);
+
+    if (state->exception) {
+      std::rethrow_exception(state->exception);
+    }
+
+    if constexpr (!std::is_void_v<T>) {
+      return std::move(*state->value);
+    }
+  }
+
+  /**
+   * @brief Забыть задачу; она продолжит выполняться.
+   */
+  void Reset() {
+    state_.reset();
+  }
+};
+
+/**
+ * @brief Планировщик сопрограмм поверх общего пула потоков.
+ *
+ * Сопрограмма Task переключает место своего выполнения ожиданиями:
+ *   co_await tasks.Background(priority) - продолжить в пуле потоков;
+ *   co_await tasks.NextTick()           - продолжить в потоке логики в следующем тике;
+ *   co_await tasks.MainThread()         - продолжить в потоке логики в ближайшей точке синхронизации;
+ *   co_await tasks.Yield()              - уступить поток, если отведенный отрезок времени исчерпан;
+ *   co_await task                       - выполнить вложенную задачу и получить ее результат.
+ *
+ * В пуле готовые продолжения выбираются по приоритету, а сами потоки пула перехватывают работу
+ * друг у друга. Поток логики выполняет продолжения в Update в пределах бюджета времени,
+ * оставшиеся переходят на следующий тик.
+ *
+ * @note Потоком логики считается поток, вызывающий Update; при конвейере кадра это не главный поток.
+ * Результаты фоновых задач зависят от времени выполнения, поэтому повтор записанного ввода
+ * воспроизводит их только при тех же таймингах.
+ */
+class TaskScheduler final {
+public:
+  /**
+   * @brief Статистика планировщика.
+   */
+  struct Stats {
+    size_t active{0};      //< Количество выполняющихся задач верхнего уровня
+    size_t queued{0};      //< Количество продолжений в очередях
+    uint64_t launched{0};  //< Количество запущенных задач
+    uint64_t completed{0}; //< Количество завершенных задач
+    uint64_t cancelled{0}; //< Количество отмененных задач
+    double update_ms{0.0}; //< Длительность последнего Update
+  };
+
+  /**
+   * @brief Ожидание переноса в пул потоков.
+   */
+  class BackgroundAwaiter final {
+  private:
+    TaskScheduler* scheduler_;
+    TaskPriority priority_;
+
+  public:
+    BackgroundAwaiter(TaskScheduler* scheduler, TaskPriority priority) : scheduler_(scheduler), priority_(priority) {
+    }
+
+  public:
+    [[nodiscard]] bool await_ready() const noexcept {
+      return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const;
+
+    void await_resume() const noexcept {
+    }
+  };
+
+  /**
+   * @brief Ожидание следующего тика.
+   */
+  class NextTickAwaiter final {
+  private:
+    TaskScheduler* scheduler_;
+
+  public:
+    explicit NextTickAwaiter(TaskScheduler* scheduler) : scheduler_(scheduler) {
+    }
+
+  public:
+    [[nodiscard]] bool await_ready() const noexcept {
+      return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const;
+
+    void await_resume() const noexcept {
+    }
+  };
+
+  /**
+   * @brief Ожидание переноса в поток логики.
+   */
+  class MainThreadAwaiter final {
+  private:
+    TaskScheduler* scheduler_;
+
+  public:
+    explicit MainThreadAwaiter(TaskScheduler* scheduler) : scheduler_(scheduler) {
+    }
+
+  public:
+    [[nodiscard]] bool await_ready() const noexcept;
+
+    void await_suspend(std::coroutine_handle<> handle) const;
+
+    void await_resume() const noexcept {
+    }
+  };
+
+  /**
+   * @brief Ожидание, уступающее поток по истечении отрезка времени.
+   */
+  class YieldAwaiter final {
+  private:
+    TaskScheduler* scheduler_;
+
+  public:
+    explicit YieldAwaiter(TaskScheduler* scheduler) : scheduler_(scheduler) {
+    }
+
+  public:
+    [[nodiscard]] bool await_ready() const noexcept;
+
+    void await_suspend(std::coroutine_handle<> handle) const;
+
+    void await_resume() const noexcept {
+    }
+  };
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Сопрограмма-обертка, которая сохраняет результат задачи в ее состояние.
+   */
+  class RootTask final {
+  public:
+    struct promise_type {
+      TaskScheduler* scheduler{nullptr}; //< Планировщик, запустивший задачу
+      detail::TaskRoot* root{nullptr};   //< Запись о задаче в планировщике
+
+      ~promise_type() noexcept {
+        if (scheduler) {
+          scheduler->Unregister(root);
+        }
+      }
+
+      [[nodiscard]] RootTask get_return_object() noexcept {
+        return RootTask(std::coroutine_handle<promise_type>::from_promise(*this));
+      }
+
+      [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+        return {};
+      }
+
+      [[nodiscard]] std::suspend_never final_suspend() const noexcept {
+        return {};
+      }
+
+      void return_void() const noexcept {
+      }
+
+      void unhandled_exception() const noexcept {
+        std::terminate();
+      }
+    };
+
+  public:
+    std::coroutine_handle<promise_type> handle;
+
+  public:
+    explicit RootTask(std::coroutine_handle<promise_type> coroutine) : handle(coroutine) {
+    }
+  };
+
+  /**
+   * @brief Продолжение сопрограммы в очереди.
+   */
+  struct Entry {
+    std::coroutine_handle<> handle;              //< Возобновляемая сопрограмма
+    detail::TaskRoot* root{nullptr};             //< Задача верхнего уровня, которой она принадлежит
+    TaskPriority priority{TaskPriority::Normal}; //< Приоритет задачи
+  };
+
+private:
+  ThreadPool* pool_;
+  std::mutex mutex_;                                               //< Мьютекс очередей и задач
+  std::array<std::deque<Entry>, kTaskPriorityCount> background_;   //< Продолжения для пула по приоритетам
+  std::deque<Entry> main_queue_;                                   //< Продолжения для потока логики
+  std::vector<Entry> next_tick_;                                   //< Продолжения до следующего тика
+  std::unordered_map<const detail::TaskRoot*, std::unique_ptr<detail::TaskRoot>> roots_; //< Запущенные задачи
+  std::atomic<size_t> posted_{0};                                  //< Количество поставленных в пул выборок
+  std::atomic<bool> stopping_{false};                              //< Планировщик уничтожается
+  Clock::duration main_budget_{std::chrono::milliseconds(2)};      //< Бюджет потока логики на тик
+  Clock::duration slice_{std::chrono::milliseconds(1)};            //< Отрезок времени до уступки в Yield
+  Stats stats_;
+
+public:
+  explicit TaskScheduler(ThreadPool* pool);
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler(TaskScheduler&&) = delete;
+  ~TaskScheduler() noexcept;
+
+public:
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+public:
+  /**
+   * @brief Запустить задачу в пуле потоков.
+   *
+   * @param task Задача.
+   * @param priority Приоритет задачи и всех ее продолжений в пуле.
+   * @param owner Владелец, вместе с которым задача отменяется (см. Cancel); nullptr - без владельца.
+   * @return TaskHandle<T> Дескриптор для получения результата.
+   */
+  template<typename T>
+  TaskHandle<T> Launch(Task<T> task, TaskPriority priority = TaskPriority::Normal, const void* owner = nullptr) {
+    auto state = std::make_shared<detail::TaskState<T>>();
+    Start(Run(std::move(task), state).handle, state, priority, owner);
+    return TaskHandle<T>(std::move(state));
+  }
+
+  [[nodiscard]] BackgroundAwaiter Background(TaskPriority priority = TaskPriority::Normal) {
+    return BackgroundAwaiter(this, priority);
+  }
+
+  [[nodiscard]] NextTickAwaiter NextTick() {
+    return NextTickAwaiter(this);
+  }
+
+  [[nodiscard]] MainThreadAwaiter MainThread() {
+    return MainThreadAwaiter(this);
+  }
+
+  [[nodiscard]] YieldAwaiter Yield() {
+    return YieldAwaiter(this);
+  }
+
+  /**
+   * @brief Выполнить продолжения, ожидающие поток логики, в пределах бюджета времени.
+   *
+   * @note Вызывается из потока логики, когда системы не выполняются.
+   */
+  void Update();
+
+  /**
+   * @brief Отменить задачи владельца и дождаться, пока ни одна из них не выполняется.
+   *
+   * Задачи уничтожаются в ближайшей точке приостановки; выполняющиеся в пуле дорабатывают
+   * до нее, а вызывающий поток тем временем помогает пулу.
+   *
+   * @param owner Владелец, переданный в Launch.
+   * @note Вызывается из потока логики между тиками.
+   */
+  void Cancel(const void* owner);
+
+  /**
+   * @brief Установить бюджет потока логики на один Update.
+   */
+  void SetMainBudget(Clock::duration budget);
+
+  /**
+   * @brief Установить отрезок времени, после которого Yield уступает поток.
+   */
+  void SetSlice(Clock::duration slice);
+
+  [[nodiscard]] Stats GetStats();
+
+  /**
+   * @brief Проверить, выполняется ли в вызывающем потоке задача в пуле.
+   *
+   * @return true Если вызов сделан из задачи между co_await Background() или Yield() и
+   * возвратом в поток логики; там нельзя обращаться к реестру и буферам команд систем.
+   */
+  [[nodiscard]] static bool IsInBackground();
+
+private:
+  template<typename T>
+  static RootTask Run(Task<T> task, std::shared_ptr<detail::TaskState<T>> state) {
+    try {
+      if constexpr (std::is_void_v<T>) {
+        co_await std::move(task);
+      }
+      else {
+        state->value.emplace(co_await std::move(task));
+      }
+    }
+    catch (...) {
+      state->exception = std::current_exception();
+    }
+
+    state->ready.store(true, std::memory_order_release);
+  }
+
+  void Start(
+    std::coroutine_handle<RootTask::promise_type> handle, std::shared_ptr<detail::TaskStateBase> state,
+    TaskPriority priority, const void* owner
+  );
+  void Unregister(const detail::TaskRoot* root);
+  void Post(Entry entry);
+  void Drain();
+  void Resume(const Entry& entry, bool main);
+  [[nodiscard]] size_t Purge();
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_JOBS_TASK_SCHEDULER_H
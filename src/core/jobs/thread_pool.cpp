@@ -0,0 +1,162 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace gb {
+
+namespace {
+
+  thread_local const ThreadPool* current_pool{nullptr}; //< Пул, которому принадлежит текущий поток
+  thread_local size_t current_worker_index{0}; //< Индекс текущего рабочего потока в пуле
+
+  constexpr size_t kInitialQueueCapacity = 64; //< Начальная вместимость очереди задач
+
+} // namespace
+
+void ThreadPool::Queue::PushBack(Task task) {
+  if (size == tasks.size()) {
+    // Задачи переносятся в новый буфер по порядку, начиная с его начала.
+    std::vector<Task> grown(std::max(kInitialQueueCapacity, tasks.size() * 2));
+    for (auto i = size_t{0}; i < size; i++) {
+      grown[i] = std::move(tasks[(head + i) & (tasks.size() - 1)]);
+    }
+    tasks.swap(grown);
+    head = 0;
+  }
+
+  tasks[(head + size) & (tasks.size() - 1)] = std::move(task);
+  size++;
+}
+
+ThreadPool::Task ThreadPool::Queue::PopBack() {
+  size--;
+  return std::move(tasks[(head + size) & (tasks.size() - 1)]);
+}
+
+ThreadPool::Task ThreadPool::Queue::PopFront() {
+  auto task = std::move(tasks[head]);
+  head = (head + 1) & (tasks.size() - 1);
+  size--;
+  return task;
+}
+
+ThreadPool::ThreadPool(size_t worker_count) {
+  // Последняя очередь принадлежит внешним потокам.
+  for (auto i = size_t{0}; i < worker_count + 1; i++) {
+    auto& queue = queues_.emplace_back(std::make_unique<Queue>());
+    queue->tasks.resize(kInitialQueueCapacity);
+  }
+
+  threads_.reserve(worker_count);
+  for (auto i = size_t{0}; i < worker_count; i++) {
+    threads_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+  {
+    std::lock_guard lock(sleep_mutex_);
+    running_.store(false, std::memory_order_release);
+  }
+  sleep_condition_.notify_all();
+
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ThreadPool::Submit(Task task) {
+  auto index = GetCurrentWorkerIndex();
+  if (index == GetWorkerCount() && GetWorkerCount() > 0) {
+    index = next_queue_.fetch_add(1, std::memory_order_relaxed) % GetWorkerCount();
+  }
+
+  {
+    std::lock_guard lock(queues_[index]->mutex);
+    queues_[index]->PushBack(std::move(task));
+  }
+  pending_.fetch_add(1, std::memory_order_release);
+
+  {
+    std::lock_guard lock(sleep_mutex_);
+  }
+  sleep_condition_.notify_one();
+}
+
+bool ThreadPool::RunPendingTask() {
+  Task task;
+  auto index = GetCurrentWorkerIndex();
+
+  if (TryPop(index, task) || TrySteal(index, task)) {
+    task();
+    return true;
+  }
+
+  return false;
+}
+
+size_t ThreadPool::GetWorkerCount() const {
+  return threads_.size();
+}
+
+size_t ThreadPool::GetConcurrency() const {
+  return threads_.size() + 1;
+}
+
+size_t ThreadPool::GetCurrentWorkerIndex() const {
+  return current_pool == this ? current_worker_index : GetWorkerCount();
+}
+
+void ThreadPool::WorkerLoop(size_t index) {
+  current_pool = this;
+  current_worker_index = index;
+
+  Task task;
+  while (running_.load(std::memory_order_acquire)) {
+    if (TryPop(index, task) || TrySteal(index, task)) {
+      task();
+      task = nullptr;
+      continue;
+    }
+
+    std::unique_lock lock(sleep_mutex_);
+    sleep_condition_.wait(lock, [this] {
+      return pending_.load(std::memory_order_acquire) > 0 || !running_.load(std::memory_order_acquire);
+    });
+  }
+}
+
+bool ThreadPool::TryPop(size_t index, Task& task) {
+  auto& queue = *queues_[index];
+  std::lock_guard lock(queue.mutex);
+
+  if (queue.size == 0) {
+    return false;
+  }
+
+  task = queue.PopBack();
+  pending_.fetch_sub(1, std::memory_order_acq_rel);
+  return true;
+}
+
+bool ThreadPool::TrySteal(size_t thief_index, Task& task) {
+  if (pending_.load(std::memory_order_acquire) == 0) {
+    return false;
+  }
+
+  for (auto offset = size_t{1}; offset < queues_.size(); offset++) {
+    auto& queue = *queues_[(thief_index + offset) % queues_.size()];
+    std::lock_guard lock(queue.mutex);
+
+    if (queue.size != 0) {
+      task = queue.PopFront();
+      pending_.fetch_sub(1, std::memory_order_acq_rel);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace gb
@@ -0,0 +1,127 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_JOBS_THREAD_POOL_H
+#define GUIDING_BREEZE_SRC_CORE_JOBS_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gb {
+
+/**
+ * @brief Пул рабочих потоков с перехватом задач.
+ *
+ * Каждый рабочий поток владеет собственной очередью: новые задачи рабочий берет с конца
+ * своей очереди, а при ее опустошении перехватывает задачи с начала чужих очередей.
+ * Поток, ожидающий завершения задач, сам выполняет задачи из очередей, поэтому пул
+ * без рабочих потоков также корректен - все задачи выполнит ожидающий поток.
+ */
+class ThreadPool final {
+public:
+  /**
+   * @note Задачи, которые ставятся каждый тик, захватывают не больше двух указателей: такие
+   * замыкания std::function хранит без выделения памяти.
+   */
+  using Task = std::function<void()>;
+
+private:
+  /**
+   * @brief Очередь задач на кольцевом буфере. Буфер только растет, поэтому после прогрева
+   * постановка задач в очередь не выделяет память.
+   */
+  struct Queue {
+    std::mutex mutex;        //< Мьютекс очереди
+    std::vector<Task> tasks; //< Кольцевой буфер задач; размер - степень двойки
+    size_t head{0};          //< Индекс первой задачи в буфере
+    size_t size{0};          //< Количество задач в очереди
+
+    void PushBack(Task task);
+    [[nodiscard]] Task PopBack();
+    [[nodiscard]] Task PopFront();
+  };
+
+private:
+  std::vector<std::unique_ptr<Queue>> queues_; //< Очереди задач; по одной на рабочий поток и одна общая
+  std::vector<std::thread> threads_;           //< Рабочие потоки
+  std::atomic<size_t> pending_{0};             //< Количество задач в очередях
+  std::atomic<size_t> next_queue_{0};          //< Счетчик для распределения внешних задач по очередям
+  std::atomic<bool> running_{true};            //< Флаг работы пула
+  std::mutex sleep_mutex_;                     //< Мьютекс для ожидания рабочими новых задач
+  std::condition_variable sleep_condition_;    //< Условная переменная для ожидания новых задач
+
+public:
+  /**
+   * @brief Создать пул.
+   *
+   * @param worker_count Количество рабочих потоков; может быть равно нулю.
+   */
+  explicit ThreadPool(size_t worker_count);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ~ThreadPool() noexcept;
+
+public:
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+public:
+  /**
+   * @brief Поставить задачу в очередь.
+   *
+   * @param task Задача.
+   * @note Задача, поставленная из рабочего потока, попадает в его собственную очередь.
+   */
+  void Submit(Task task);
+
+  /**
+   * @brief Выполнить одну задачу из очередей в вызывающем потоке.
+   *
+   * @return true Если задача была выполнена.
+   * @return false Если очереди пусты.
+   */
+  bool RunPendingTask();
+
+  /**
+   * @brief Выполнять задачи из очередей, пока условие не станет истинным.
+   *
+   * @param predicate Условие завершения ожидания.
+   */
+  template<typename Predicate>
+  void WaitUntil(Predicate&& predicate) {
+    while (!predicate()) {
+      if (!RunPendingTask()) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  /**
+   * @brief Получить количество рабочих потоков.
+   */
+  [[nodiscard]] size_t GetWorkerCount() const;
+
+  /**
+   * @brief Получить количество потоков, одновременно выполняющих задачи, включая ожидающий.
+   */
+  [[nodiscard]] size_t GetConcurrency() const;
+
+  /**
+   * @brief Получить индекс рабочего потока пула, в котором выполняется вызов.
+   *
+   * @return size_t Индекс в диапазоне [0; GetWorkerCount()), либо GetWorkerCount()
+   * для любого другого потока.
+   */
+  [[nodiscard]] size_t GetCurrentWorkerIndex() const;
+
+private:
+  void WorkerLoop(size_t index);
+  bool TryPop(size_t index, Task& task);
+  bool TrySteal(size_t thief_index, Task& task);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_JOBS_THREAD_POOL_H
@@ -0,0 +1,72 @@
+#include "frame_arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace gb {
+
+FrameArena::FrameArena(size_t capacity) {
+  AddBlock(std::max<size_t>(capacity, 1024));
+}
+
+void FrameArena::Reset() {
+  // Дополнительные блоки сливаются в один, чтобы в следующих кадрах хватило одного блока.
+  if (blocks_.size() > 1) {
+    auto capacity = GetCapacity();
+    blocks_.clear();
+    AddBlock(capacity);
+  }
+
+  current_ = blocks_.back().data.get();
+  end_ = current_ + blocks_.back().size;
+  used_ = 0;
+}
+
+size_t FrameArena::GetUsed() const {
+  return used_;
+}
+
+size_t FrameArena::GetPeak() const {
+  return peak_;
+}
+
+size_t FrameArena::GetCapacity() const {
+  auto capacity = size_t{0};
+  for (const auto& block : blocks_) {
+    capacity += block.size;
+  }
+  return capacity;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+  auto address = reinterpret_cast<uintptr_t>(current_);
+  auto aligned = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+  if (aligned + bytes > reinterpret_cast<uintptr_t>(end_)) {
+    AddBlock(std::max(blocks_.back().size * 2, bytes + alignment));
+    address = reinterpret_cast<uintptr_t>(current_);
+    aligned = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+  }
+
+  current_ = reinterpret_cast<std::byte*>(aligned + bytes);
+  used_ += bytes;
+  peak_ = std::max(peak_, used_);
+
+  return reinterpret_cast<void*>(aligned);
+}
+
+void FrameArena::do_deallocate(void*, size_t, size_t) {
+}
+
+bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+void FrameArena::AddBlock(size_t size) {
+  // Память блока не инициализируется: make_unique обнулял бы ее при каждом слиянии блоков.
+  auto& block = blocks_.emplace_back(Block{std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+  current_ = block.data.get();
+  end_ = current_ + size;
+}
+
+} // namespace gb
@@ -0,0 +1,85 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_MEMORY_FRAME_ARENA_H
+#define GUIDING_BREEZE_SRC_CORE_MEMORY_FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace gb {
+
+/**
+ * @brief Линейный распределитель памяти для данных, живущих не дольше кадра.
+ *
+ * Выделение сдвигает указатель внутри блока, освобождение ничего не делает - вся память
+ * возвращается разом в Reset. Если блока не хватило, берется дополнительный блок из кучи,
+ * а при следующем Reset все блоки заменяются одним блоком суммарного размера, поэтому после
+ * прогрева арена не обращается к куче.
+ *
+ * Совместим с std::pmr: контейнеры std::pmr::vector, std::pmr::string и другие получают его
+ * через std::pmr::polymorphic_allocator.
+ *
+ * @note Не потокобезопасен: у каждого потока должна быть своя арена.
+ */
+class FrameArena final : public std::pmr::memory_resource {
+private:
+  struct Block {
+    std::unique_ptr<std::byte[]> data; //< Память блока
+    size_t size;                       //< Размер блока в байтах
+  };
+
+private:
+  std::vector<Block> blocks_;   //< Блоки; после Reset - ровно один
+  std::byte* current_{nullptr}; //< Следующий свободный байт текущего блока
+  std::byte* end_{nullptr};     //< Конец текущего блока
+  size_t used_{0};              //< Количество байтов, выделенных с последнего Reset
+  size_t peak_{0};              //< Наибольшее количество байтов, выделенных за кадр
+
+public:
+  /**
+   * @param capacity Начальный размер блока в байтах.
+   */
+  explicit FrameArena(size_t capacity = 64 * 1024);
+  FrameArena(const FrameArena&) = delete;
+  FrameArena(FrameArena&&) = delete;
+  ~FrameArena() noexcept override = default;
+
+public:
+  FrameArena& operator=(const FrameArena&) = delete;
+  FrameArena& operator=(FrameArena&&) = delete;
+
+public:
+  /**
+   * @brief Освободить всю выделенную память.
+   *
+   * @note Все указатели и контейнеры, полученные из арены, становятся недействительными.
+   */
+  void Reset();
+
+  /**
+   * @brief Получить количество байтов, выделенных с последнего Reset.
+   */
+  [[nodiscard]] size_t GetUsed() const;
+
+  /**
+   * @brief Получить наибольшее количество байтов, выделенных между двумя Reset.
+   */
+  [[nodiscard]] size_t GetPeak() const;
+
+  /**
+   * @brief Получить суммарный размер блоков.
+   */
+  [[nodiscard]] size_t GetCapacity() const;
+
+protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+  void AddBlock(size_t size);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_MEMORY_FRAME_ARENA_H
@@ -0,0 +1,121 @@
+#include "frame_memory.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+
+#if defined(GB_COUNT_ALLOCATIONS) && defined(_WIN32)
+  #include <malloc.h>
+#endif
+
+namespace gb::FrameMemory {
+
+namespace {
+
+  std::atomic<uint64_t> heap_allocations{0}; //< Общее количество выделений в куче
+
+  std::mutex arenas_mutex; //< Мьютекс списка арен
+  std::vector<std::unique_ptr<FrameArena>> arenas; //< Арены всех потоков, когда-либо обращавшихся к памяти кадра
+  thread_local FrameArena* thread_arena{nullptr}; //< Арена текущего потока
+
+  uint64_t frame_start_allocations{0}; //< Значение счетчика выделений в начале кадра
+  Stats stats; //< Статистика последнего завершенного кадра
+
+} // namespace
+
+void BeginFrame() {
+  auto allocations = heap_allocations.load(std::memory_order_relaxed);
+
+#if defined(GB_COUNT_ALLOCATIONS)
+  stats.counting = true;
+#endif
+  stats.heap_allocations = allocations - frame_start_allocations;
+  stats.arena_used = 0;
+  stats.arena_capacity = 0;
+
+  {
+    const std::lock_guard lock(arenas_mutex);
+    stats.arena_count = arenas.size();
+    for (auto& arena : arenas) {
+      stats.arena_used += arena->GetUsed();
+      arena->Reset();
+      stats.arena_capacity += arena->GetCapacity();
+    }
+  }
+
+  // Выделения при сбросе арен относятся к прошедшему кадру: они происходят, только если арене не хватило блока.
+  frame_start_allocations = heap_allocations.load(std::memory_order_relaxed);
+}
+
+FrameArena& GetArena() {
+  if (!thread_arena) {
+    auto arena = std::make_unique<FrameArena>();
+    thread_arena = arena.get();
+
+    const std::lock_guard lock(arenas_mutex);
+    arenas.push_back(std::move(arena));
+  }
+
+  return *thread_arena;
+}
+
+std::pmr::polymorphic_allocator<std::byte> GetAllocator() {
+  return std::pmr::polymorphic_allocator<std::byte>(&GetArena());
+}
+
+uint64_t GetHeapAllocationCount() {
+  return heap_allocations.load(std::memory_order_relaxed);
+}
+
+const Stats& GetStats() {
+  return stats;
+}
+
+} // namespace gb::FrameMemory
+
+#if defined(GB_COUNT_ALLOCATIONS)
+
+// Замена глобальных функций выделения памяти. Остальные формы (массивы, nothrow, с размером)
+// по стандарту вызывают эти четыре, поэтому тоже подсчитываются.
+
+void* operator new(std::size_t size) {
+  gb::FrameMemory::heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (auto* pointer = std::malloc(size ? size : 1)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  gb::FrameMemory::heap_allocations.fetch_add(1, std::memory_order_relaxed);
+
+  auto align = static_cast<std::size_t>(alignment);
+  size = (size + align - 1) / align * align;
+
+#if defined(_WIN32)
+  auto* pointer = _aligned_malloc(size ? size : align, align);
+#else
+  auto* pointer = std::aligned_alloc(align, size ? size : align);
+#endif
+
+  if (pointer) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+#if defined(_WIN32)
+  _aligned_free(pointer);
+#else
+  std::free(pointer);
+#endif
+}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_MEMORY_FRAME_MEMORY_H
+#define GUIDING_BREEZE_SRC_CORE_MEMORY_FRAME_MEMORY_H
+
+#include "core/memory/frame_arena.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fmt/format.h"
+
+/**
+ * @brief Память кадра: арены потоков, сбрасываемые в начале каждого кадра, и счетчик
+ * выделений памяти в куче.
+ *
+ * Счетчик работает, если сборка выполнена с GB_COUNT_ALLOCATIONS (сборка Debug либо параметр
+ * CMake GUIDING_BREEZE_COUNT_ALLOCATIONS): тогда глобальные operator new/delete заменяются
+ * версиями, подсчитывающими вызовы.
+ */
+namespace gb::FrameMemory {
+
+/**
+ * @brief Строка в памяти кадра.
+ */
+using String = std::pmr::string;
+
+/**
+ * @brief Массив в памяти кадра.
+ */
+template<typename T>
+using Vector = std::pmr::vector<T>;
+
+/**
+ * @brief Статистика памяти за последний завершенный кадр.
+ */
+struct Stats {
+  bool counting{false};         //< Подсчитываются ли выделения в куче
+  uint64_t heap_allocations{0}; //< Количество выделений в куче за кадр во всех потоках
+  size_t arena_count{0};        //< Количество арен потоков
+  size_t arena_used{0};         //< Байтов выделено из арен за кадр
+  size_t arena_capacity{0};     //< Суммарный размер арен
+};
+
+/**
+ * @brief Начать кадр: сбросить арены всех потоков и подвести итог прошедшего кадра.
+ *
+ * @note Вызывается в начале главного цикла, когда ни один поток не использует память кадра.
+ */
+void BeginFrame();
+
+/**
+ * @brief Получить арену вызывающего потока.
+ *
+ * @return FrameArena& Арена; создается при первом обращении потока и живет до конца работы программы.
+ */
+[[nodiscard]] FrameArena& GetArena();
+
+/**
+ * @brief Получить распределитель для контейнеров в памяти кадра вызывающего потока.
+ */
+[[nodiscard]] std::pmr::polymorphic_allocator<std::byte> GetAllocator();
+
+/**
+ * @brief Отформатировать строку в памяти кадра.
+ *
+ * @return String Строка; действительна до начала следующего кадра.
+ */
+template<typename... Args>
+[[nodiscard]] String Format(fmt::format_string<Args...> format, Args&&... args) {
+  String result(GetAllocator());
+  fmt::format_to(std::back_inserter(result), format, std::forward<Args>(args)...);
+  return result;
+}
+
+/**
+ * @brief Получить общее количество выделений памяти в куче с начала работы программы.
+ *
+ * @return uint64_t Количество выделений; 0, если подсчет выключен.
+ */
+[[nodiscard]] uint64_t GetHeapAllocationCount();
+
+/**
+ * @brief Получить статистику за последний завершенный кадр.
+ */
+[[nodiscard]] const Stats& GetStats();
+
+} // namespace gb::FrameMemory
+
+#endif // GUIDING_BREEZE_SRC_CORE_MEMORY_FRAME_MEMORY_H
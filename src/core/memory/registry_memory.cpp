@@ -0,0 +1,263 @@
+#include "registry_memory.hpp"
+
+#include "logger/logger.hpp"
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "fmt/format.h"
+#include "imgui.h"
+
+namespace gb {
+
+namespace {
+
+  constexpr auto kSampleInterval = std::chrono::milliseconds(500); //< Период замера памяти
+  constexpr size_t kSparsePage = ENTT_SPARSE_PAGE; //< Количество идентификаторов в странице разреженного массива
+  constexpr size_t kSparsePageBytes = kSparsePage * sizeof(entt::entity); //< Размер страницы разреженного массива
+  constexpr double kMegabyte = 1024.0 * 1024.0;
+
+} // namespace
+
+RegistryMemory::RegistryMemory(entt::registry* registry)
+  : registry_(registry),
+    last_sample_(Clock::now()) {
+  // Хранилище идентификаторов учитывается всегда: после массового удаления оно не уменьшается.
+  Tracked entities;
+  entities.stats.name = "entt::entity";
+  entities.stats.category = "Сущности";
+  entities.measure = [](entt::registry& registry, StorageStats& stats) {
+    const auto& storage = registry.storage<entt::entity>();
+    stats.size = storage.size();
+    stats.capacity = storage.capacity();
+    MeasureSparse(storage, stats);
+  };
+  entities.shrink = [](entt::registry& registry) {
+    registry.storage<entt::entity>().shrink_to_fit();
+  };
+  AddTracked(std::move(entities));
+
+  registry_->on_construct<entt::entity>().connect<&RegistryMemory::OnCreate>(*this);
+  registry_->on_destroy<entt::entity>().connect<&RegistryMemory::OnDestroy>(*this);
+}
+
+RegistryMemory::~RegistryMemory() noexcept {
+  registry_->on_construct<entt::entity>().disconnect<&RegistryMemory::OnCreate>(*this);
+  registry_->on_destroy<entt::entity>().disconnect<&RegistryMemory::OnDestroy>(*this);
+}
+
+void RegistryMemory::SetBudget(std::string_view category, size_t bytes) {
+  auto& stats = FindCategory(category);
+  stats.budget_bytes = bytes;
+  stats.over_budget = false;
+}
+
+void RegistryMemory::Update() {
+  if (Clock::now() - last_sample_ < kSampleInterval) {
+    return;
+  }
+
+  Sample();
+}
+
+size_t RegistryMemory::Shrink() {
+  GB_PROFILE_ZONE("Сжатие хранилищ");
+
+  Sample();
+  auto before = stats_.reserved_bytes;
+
+  for (auto& tracked : tracked_) {
+    tracked.shrink(*registry_);
+  }
+
+  Sample();
+  stats_.shrinks++;
+  stats_.last_shrink_bytes = before > stats_.reserved_bytes ? before - stats_.reserved_bytes : 0;
+
+  Logger::Info("Хранилища реестра сжаты, освобождено {:.2f} МБ.", stats_.last_shrink_bytes / kMegabyte);
+  return stats_.last_shrink_bytes;
+}
+
+const RegistryMemory::Stats& RegistryMemory::GetStats() const {
+  return stats_;
+}
+
+const std::vector<RegistryMemory::CategoryStats>& RegistryMemory::GetCategories() const {
+  return categories_;
+}
+
+void RegistryMemory::DrawWindow() {
+  if (!ImGui::Begin("Память реестра")) {
+    ImGui::End();
+    return;
+  }
+
+  ImGui::Text("Сущностей: %zu, идентификаторов: %zu", stats_.alive, stats_.entity_slots);
+  ImGui::Text(
+    "Создается: %.1f/с, удаляется: %.1f/с (всего %llu и %llu)", stats_.created_per_second,
+    stats_.destroyed_per_second, static_cast<unsigned long long>(stats_.created),
+    static_cast<unsigned long long>(stats_.destroyed)
+  );
+  ImGui::Text(
+    "Занято: %.2f МБ, зарезервировано: %.2f МБ, потеряно: %.2f МБ", stats_.live_bytes / kMegabyte,
+    stats_.reserved_bytes / kMegabyte, (stats_.reserved_bytes - stats_.live_bytes) / kMegabyte
+  );
+
+  if (ImGui::Button("Сжать хранилища")) {
+    Shrink();
+  }
+  if (stats_.shrinks > 0) {
+    ImGui::SameLine();
+    ImGui::Text("Последнее сжатие освободило %.2f МБ", stats_.last_shrink_bytes / kMegabyte);
+  }
+
+  ImGui::SeparatorText("Категории");
+
+  for (const auto& category : categories_) {
+    if (category.budget_bytes == 0) {
+      ImGui::Text("%s: %.2f МБ, без бюджета", category.name.c_str(), category.reserved_bytes / kMegabyte);
+      continue;
+    }
+
+    auto fraction = static_cast<float>(category.reserved_bytes) / category.budget_bytes;
+    ImGui::ProgressBar(std::min(fraction, 1.0F), ImVec2(-1.0F, 0.0F), category.label.c_str());
+  }
+
+  ImGui::SeparatorText("Хранилища");
+
+  constexpr auto kTableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY;
+  if (ImGui::BeginTable("##storages", 7, kTableFlags, ImVec2(0.0F, 240.0F))) {
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Компонент");
+    ImGui::TableSetupColumn("Категория");
+    ImGui::TableSetupColumn("Количество");
+    ImGui::TableSetupColumn("Занято, КБ");
+    ImGui::TableSetupColumn("Резерв, КБ");
+    ImGui::TableSetupColumn("Потеряно, КБ");
+    ImGui::TableSetupColumn("Страниц");
+    ImGui::TableHeadersRow();
+
+    for (const auto& tracked : tracked_) {
+      const auto& stats = tracked.stats;
+
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(stats.name.c_str());
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(stats.category.c_str());
+      ImGui::TableNextColumn();
+      ImGui::Text("%zu из %zu", stats.size, stats.capacity);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", stats.live_bytes / 1024.0);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", stats.reserved_bytes / 1024.0);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.1f", (stats.reserved_bytes - stats.live_bytes) / 1024.0);
+      ImGui::TableNextColumn();
+      ImGui::Text("%zu из %zu", stats.used_pages, stats.sparse_pages);
+    }
+
+    ImGui::EndTable();
+  }
+
+  ImGui::End();
+}
+
+void RegistryMemory::MeasureSparse(const entt::sparse_set& set, StorageStats& stats) {
+  // Точное заполнение страниц требует перебора сущностей; без него нужными считаются столько
+  // страниц, сколько заняли бы идентификаторы хранилища, если бы шли подряд
+  stats.sparse_pages = set.extent() / kSparsePage;
+  stats.used_pages = std::min(stats.sparse_pages, (stats.size + kSparsePage - 1) / kSparsePage);
+
+  auto element_bytes = stats.element_size + sizeof(entt::entity);
+  stats.live_bytes = stats.size * element_bytes + stats.used_pages * kSparsePageBytes;
+  stats.reserved_bytes = std::max(stats.capacity, stats.size) * element_bytes + stats.sparse_pages * kSparsePageBytes;
+  stats.reserved_bytes = std::max(stats.reserved_bytes, stats.live_bytes);
+}
+
+void RegistryMemory::AddTracked(Tracked tracked) {
+  FindCategory(tracked.stats.category);
+  tracked_.push_back(std::move(tracked));
+}
+
+RegistryMemory::CategoryStats& RegistryMemory::FindCategory(std::string_view name) {
+  auto it = std::find_if(categories_.begin(), categories_.end(), [name](const CategoryStats& category) {
+    return category.name == name;
+  });
+
+  if (it != categories_.end()) {
+    return *it;
+  }
+
+  auto& category = categories_.emplace_back();
+  category.name = name;
+  return category;
+}
+
+void RegistryMemory::Sample() {
+  GB_PROFILE_ZONE("Замер памяти реестра");
+
+  auto now = Clock::now();
+
+  stats_.live_bytes = 0;
+  stats_.reserved_bytes = 0;
+  for (auto& category : categories_) {
+    category.live_bytes = 0;
+    category.reserved_bytes = 0;
+  }
+
+  for (auto& tracked : tracked_) {
+    tracked.measure(*registry_, tracked.stats);
+
+    auto& category = FindCategory(tracked.stats.category);
+    category.live_bytes += tracked.stats.live_bytes;
+    category.reserved_bytes += tracked.stats.reserved_bytes;
+    stats_.live_bytes += tracked.stats.live_bytes;
+    stats_.reserved_bytes += tracked.stats.reserved_bytes;
+  }
+
+  // Хранилище идентификаторов хранит и освобожденные идентификаторы; живые идут в начале до free_list
+  const auto& entities = registry_->storage<entt::entity>();
+  stats_.entity_slots = entities.size();
+  stats_.alive = entities.free_list();
+
+  auto seconds = std::chrono::duration<double>(now - last_sample_).count();
+  if (seconds > 0.0) {
+    stats_.created_per_second = (stats_.created - sampled_created_) / seconds;
+    stats_.destroyed_per_second = (stats_.destroyed - sampled_destroyed_) / seconds;
+  }
+  sampled_created_ = stats_.created;
+  sampled_destroyed_ = stats_.destroyed;
+  last_sample_ = now;
+
+  for (auto& category : categories_) {
+    auto over_budget = category.budget_bytes > 0 && category.reserved_bytes > category.budget_bytes;
+    if (over_budget && !category.over_budget) {
+      Logger::Warn(
+        "Память категории '{}' превысила бюджет: {:.2f} из {:.2f} МБ.", category.name,
+        category.reserved_bytes / kMegabyte, category.budget_bytes / kMegabyte
+      );
+    }
+    category.over_budget = over_budget;
+
+    // Подпись форматируется при замере, а не в каждом кадре окна
+    if (category.budget_bytes > 0) {
+      category.label.clear();
+      fmt::format_to(
+        std::back_inserter(category.label), "{}: {:.2f} из {:.2f} МБ", category.name,
+        category.reserved_bytes / kMegabyte, category.budget_bytes / kMegabyte
+      );
+    }
+  }
+}
+
+void RegistryMemory::OnCreate(entt::registry&, entt::entity) {
+  stats_.created++;
+}
+
+void RegistryMemory::OnDestroy(entt::registry&, entt::entity) {
+  stats_.destroyed++;
+}
+
+} // namespace gb
@@ -0,0 +1,183 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_MEMORY_REGISTRY_MEMORY_H
+#define GUIDING_BREEZE_SRC_CORE_MEMORY_REGISTRY_MEMORY_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace gb {
+
+/**
+ * @brief Учет памяти реестра сущностей: занятая, зарезервированная и потерянная память хранилищ,
+ * частота создания и удаления сущностей, заполнение страниц разреженных массивов и бюджеты категорий.
+ *
+ * Хранилища учитываются после Track. Память оценивается по устройству хранилищ EnTT: упакованные
+ * массив сущностей и массив компонентов (у пустых компонентов его нет) растут вместе, разреженный
+ * массив состоит из страниц по ENTT_SPARSE_PAGE идентификаторов. Потерянная память - разница между
+ * зарезервированной и занятой; она остается после массового удаления и освобождается Shrink.
+ *
+ * Замер читает только размеры хранилищ и не перебирает сущности, поэтому не зависит от их количества.
+ *
+ * Бюджет задается на категорию хранилищ; при превышении в лог пишется предупреждение, повторно -
+ * только после того, как категория вернется в бюджет.
+ */
+class RegistryMemory final {
+public:
+  /**
+   * @brief Память одного хранилища.
+   */
+  struct StorageStats {
+    std::string name;         //< Имя типа компонента
+    std::string category;     //< Категория бюджета
+    size_t element_size{0};   //< Размер компонента в массиве; 0 у пустых компонентов
+    size_t size{0};           //< Количество компонентов
+    size_t capacity{0};       //< Количество компонентов, под которые выделена память
+    size_t live_bytes{0};     //< Занятая память
+    size_t reserved_bytes{0}; //< Зарезервированная память
+    size_t sparse_pages{0};   //< Страниц разреженного массива
+    size_t used_pages{0};     //< Страниц разреженного массива, нужных сущностям хранилища; оценка снизу
+  };
+
+  /**
+   * @brief Память категории хранилищ.
+   */
+  struct CategoryStats {
+    std::string name;         //< Имя категории
+    size_t live_bytes{0};     //< Занятая память
+    size_t reserved_bytes{0}; //< Зарезервированная память
+    size_t budget_bytes{0};   //< Бюджет; 0 - без ограничения
+    bool over_budget{false};  //< Превышен ли бюджет при последнем замере
+    std::string label;        //< Подпись полосы бюджета в окне; обновляется при замере
+  };
+
+  /**
+   * @brief Сводная статистика.
+   */
+  struct Stats {
+    size_t alive{0};                  //< Количество живых сущностей
+    size_t entity_slots{0};           //< Количество идентификаторов в хранилище сущностей, включая освобожденные
+    uint64_t created{0};              //< Создано сущностей с начала учета
+    uint64_t destroyed{0};            //< Удалено сущностей с начала учета
+    double created_per_second{0.0};   //< Частота создания сущностей за последний интервал замера
+    double destroyed_per_second{0.0}; //< Частота удаления сущностей за последний интервал замера
+    size_t live_bytes{0};             //< Занятая память всех хранилищ
+    size_t reserved_bytes{0};         //< Зарезервированная память всех хранилищ
+    uint64_t shrinks{0};              //< Количество сжатий
+    size_t last_shrink_bytes{0};      //< Освобождено последним сжатием
+  };
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Учитываемое хранилище.
+   */
+  struct Tracked {
+    StorageStats stats;                                          //< Последний замер
+    std::function<void(entt::registry&, StorageStats&)> measure; //< Функция замера
+    std::function<void(entt::registry&)> shrink;                 //< Функция сжатия
+  };
+
+private:
+  entt::registry* registry_;              //< Реестр сущностей
+  std::vector<Tracked> tracked_;          //< Учитываемые хранилища
+  std::vector<CategoryStats> categories_; //< Категории в порядке первого упоминания
+  Stats stats_;                           //< Сводная статистика
+  uint64_t sampled_created_{0};           //< Создано сущностей к прошлому замеру
+  uint64_t sampled_destroyed_{0};         //< Удалено сущностей к прошлому замеру
+  Clock::time_point last_sample_;         //< Время прошлого замера
+
+public:
+  /**
+   * @param registry Реестр сущностей; должен пережить объект. Учет создания и удаления сущностей
+   * начинается с момента создания объекта.
+   */
+  explicit RegistryMemory(entt::registry* registry);
+  RegistryMemory(const RegistryMemory&) = delete;
+  RegistryMemory(RegistryMemory&&) = delete;
+  ~RegistryMemory() noexcept;
+
+public:
+  RegistryMemory& operator=(const RegistryMemory&) = delete;
+  RegistryMemory& operator=(RegistryMemory&&) = delete;
+
+public:
+  /**
+   * @brief Учитывать хранилище компонента.
+   *
+   * @param category Категория бюджета, например "Отрисовка".
+   */
+  template<typename Component>
+  void Track(std::string_view category) {
+    Tracked tracked;
+    tracked.stats.name = entt::type_name<Component>::value();
+    tracked.stats.category = category;
+    tracked.stats.element_size = std::is_empty_v<Component> ? 0 : sizeof(Component);
+
+    tracked.measure = [](entt::registry& registry, StorageStats& stats) {
+      const auto& storage = registry.storage<Component>();
+      stats.size = storage.size();
+      stats.capacity = storage.capacity();
+      MeasureSparse(storage, stats);
+    };
+    tracked.shrink = [](entt::registry& registry) {
+      registry.storage<Component>().shrink_to_fit();
+    };
+
+    AddTracked(std::move(tracked));
+  }
+
+  /**
+   * @brief Задать бюджет категории.
+   *
+   * @param category Категория хранилищ.
+   * @param bytes Бюджет зарезервированной памяти; 0 - без ограничения.
+   */
+  void SetBudget(std::string_view category, size_t bytes);
+
+  /**
+   * @brief Замерить память, если с прошлого замера прошел интервал, и проверить бюджеты.
+   *
+   * @note Вызывается в точке синхронизации тика, когда ни одна система не выполняется.
+   */
+  void Update();
+
+  /**
+   * @brief Освободить зарезервированную, но не занятую память всех учитываемых хранилищ.
+   *
+   * Сжатие перевыделяет массивы, поэтому выполняется явно, например между уровнями.
+   *
+   * @return size_t Освобождено байтов по оценке замера.
+   * @note Вызывается, когда ни одна система не выполняется.
+   */
+  size_t Shrink();
+
+  [[nodiscard]] const Stats& GetStats() const;
+
+  [[nodiscard]] const std::vector<CategoryStats>& GetCategories() const;
+
+  /**
+   * @brief Отрисовать окно с памятью хранилищ и категорий.
+   */
+  void DrawWindow();
+
+private:
+  static void MeasureSparse(const entt::sparse_set& set, StorageStats& stats);
+
+  void AddTracked(Tracked tracked);
+  CategoryStats& FindCategory(std::string_view name);
+  void Sample();
+  void OnCreate(entt::registry& registry, entt::entity entity);
+  void OnDestroy(entt::registry& registry, entt::entity entity);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_MEMORY_REGISTRY_MEMORY_H
@@ -0,0 +1,74 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_PLUGINS_PLUGIN_API_H
+#define GUIDING_BREEZE_SRC_CORE_PLUGINS_PLUGIN_API_H
+
+#include "core/systems/scheduler.hpp"
+#include "core/systems/system.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+#if defined(_WIN32)
+  #define GB_PLUGIN_EXPORT extern "C" __declspec(dllexport)
+#else
+  #define GB_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace gb {
+
+/**
+ * @brief Версия интерфейса модулей систем; увеличивается при любом изменении SystemRegistrar,
+ * System или Scheduler, ломающем совместимость.
+ */
+constexpr uint32_t kPluginApiVersion = 2;
+
+/**
+ * @brief Регистратор, через который модуль добавляет свои системы в планировщик игры.
+ *
+ * Модуль экспортирует две функции с C-связыванием:
+ *   uint32_t gb_plugin_api_version() - возвращает kPluginApiVersion, с которой собран модуль;
+ *   void gb_plugin_register_systems(gb::SystemRegistrar* registrar) - добавляет системы.
+ *
+ * Все, что создано кодом модуля, должно уничтожаться до его выгрузки. Поэтому модуль только
+ * добавляет системы, а хранилища компонентов и типы событий, которые используют его системы,
+ * создает ядро до загрузки модуля: иначе они ссылались бы на код выгруженного модуля.
+ */
+class SystemRegistrar final {
+private:
+  Scheduler* scheduler_;        //< Планировщик игры
+  entt::registry* registry_;    //< Реестр сущностей игры
+  std::vector<System*>* added_; //< Системы, добавленные модулем
+
+public:
+  SystemRegistrar(Scheduler* scheduler, entt::registry* registry, std::vector<System*>* added)
+    : scheduler_(scheduler), registry_(registry), added_(added) {
+  }
+
+public:
+  /**
+   * @brief Создать систему и добавить ее в планировщик.
+   *
+   * @tparam T Тип системы; конструктор принимает entt::registry* и args.
+   * @return T& Добавленная система; удаляется при выгрузке модуля.
+   */
+  template<typename T, typename... Args>
+  T& Add(Args&&... args) {
+    auto& system = scheduler_->Add(std::make_unique<T>(registry_, std::forward<Args>(args)...));
+    added_->push_back(&system);
+    return static_cast<T&>(system);
+  }
+
+  [[nodiscard]] entt::registry& GetRegistry() const {
+    return *registry_;
+  }
+};
+
+} // namespace gb
+
+GB_PLUGIN_EXPORT uint32_t gb_plugin_api_version();
+GB_PLUGIN_EXPORT void gb_plugin_register_systems(gb::SystemRegistrar* registrar);
+
+#endif // GUIDING_BREEZE_SRC_CORE_PLUGINS_PLUGIN_API_H
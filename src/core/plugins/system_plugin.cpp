@@ -0,0 +1,208 @@
+#include "system_plugin.hpp"
+
+#include "core/plugins/plugin_api.hpp"
+#include "logger/logger.hpp"
+
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include "SDL_error.h"
+#include "SDL_loadso.h"
+
+#if defined(GB_HOT_RELOAD) && defined(__linux__)
+  #include <sys/inotify.h>
+  #include <unistd.h>
+#endif
+
+namespace gb {
+
+namespace {
+
+  using ApiVersionFunc = uint32_t (*)();
+  using RegisterSystemsFunc = void (*)(SystemRegistrar*);
+
+  constexpr auto kSettleTime = std::chrono::milliseconds(200); //< Сколько файл не должен меняться перед перезагрузкой
+  constexpr auto kPollInterval = std::chrono::milliseconds(500); //< Период проверки файла без inotify
+
+  /**
+   * @brief Получить время изменения файла.
+   *
+   * @return int64_t Время в единицах часов файловой системы; 0, если файла нет.
+   */
+  [[nodiscard]] int64_t GetWriteTime(const std::string& path) {
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(path, error);
+    return error ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+  }
+
+} // namespace
+
+SystemPlugin::SystemPlugin(std::string path, Scheduler* scheduler, entt::registry* registry)
+  : path_(std::move(path)),
+    scheduler_(scheduler),
+    registry_(registry) {
+#if defined(GB_HOT_RELOAD) && defined(__linux__)
+  // Отслеживается папка: компоновщик может записать новый файл и переименовать его поверх старого.
+  watch_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (watch_fd_ >= 0) {
+    auto directory = std::filesystem::path(path_).parent_path();
+    if (inotify_add_watch(watch_fd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+      Logger::Warn("Не удалось отслеживать папку модуля систем '{}'.", directory.string());
+      close(watch_fd_);
+      watch_fd_ = -1;
+    }
+  }
+#endif
+
+  last_write_time_ = GetWriteTime(path_);
+  last_poll_ = Clock::now();
+}
+
+SystemPlugin::~SystemPlugin() noexcept {
+  Unload();
+
+#if defined(GB_HOT_RELOAD) && defined(__linux__)
+  if (watch_fd_ >= 0) {
+    close(watch_fd_);
+  }
+#endif
+}
+
+bool SystemPlugin::Load() {
+  auto start = Clock::now();
+  auto reloading = !systems_.empty() || handle_;
+
+#if defined(GB_HOT_RELOAD)
+  // Копия с уникальным именем удаляется сразу после загрузки: отображенный в память код остается доступен.
+  auto copy = path_ + ".loaded." + std::to_string(++generation_);
+  std::error_code error;
+  std::filesystem::copy_file(path_, copy, std::filesystem::copy_options::overwrite_existing, error);
+  if (error) {
+    Logger::Error("Не удалось скопировать модуль систем '{}': {}", path_, error.message());
+    stats_.failures++;
+    return false;
+  }
+
+  auto* handle = SDL_LoadObject(copy.c_str());
+  std::filesystem::remove(copy, error);
+
+  if (!handle) {
+    Logger::Error("Не удалось загрузить модуль систем '{}': {}", path_, SDL_GetError());
+    stats_.failures++;
+    return false;
+  }
+
+  auto api_version = reinterpret_cast<ApiVersionFunc>(SDL_LoadFunction(handle, "gb_plugin_api_version"));
+  auto register_systems = reinterpret_cast<RegisterSystemsFunc>(SDL_LoadFunction(handle, "gb_plugin_register_systems"));
+
+  if (!api_version || !register_systems || api_version() != kPluginApiVersion) {
+    Logger::Error("Модуль систем '{}' несовместим с игрой (требуется версия интерфейса {}).", path_, kPluginApiVersion);
+    SDL_UnloadObject(handle);
+    stats_.failures++;
+    return false;
+  }
+
+  // Новая версия проверена; старые системы удаляются до выгрузки своего кода.
+  Unload();
+  handle_ = handle;
+#else
+  RemoveSystems();
+  auto register_systems = &gb_plugin_register_systems;
+#endif
+
+  SystemRegistrar registrar(scheduler_, registry_, &systems_);
+  register_systems(&registrar);
+
+  stats_.systems = systems_.size();
+  stats_.last_load_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  if (reloading) {
+    stats_.reloads++;
+  }
+
+  Logger::Info(
+    "Модуль систем '{}' {} за {:.2f} мс, систем: {}.", path_, reloading ? "перезагружен" : "загружен",
+    stats_.last_load_ms, stats_.systems
+  );
+  return true;
+}
+
+bool SystemPlugin::Update() {
+#if defined(GB_HOT_RELOAD)
+  if (PollChanges()) {
+    change_pending_ = true;
+    last_change_ = Clock::now();
+  }
+
+  if (!change_pending_ || Clock::now() - last_change_ < kSettleTime) {
+    return false;
+  }
+
+  change_pending_ = false;
+  Load();
+  return true;
+#else
+  return false;
+#endif
+}
+
+void SystemPlugin::Unload() {
+  RemoveSystems();
+
+  if (handle_) {
+    SDL_UnloadObject(handle_);
+    handle_ = nullptr;
+  }
+}
+
+const std::string& SystemPlugin::GetPath() const {
+  return path_;
+}
+
+const SystemPlugin::Stats& SystemPlugin::GetStats() const {
+  return stats_;
+}
+
+void SystemPlugin::RemoveSystems() {
+  for (auto* system : systems_) {
+    scheduler_->Remove(*system);
+  }
+  systems_.clear();
+  stats_.systems = 0;
+}
+
+bool SystemPlugin::PollChanges() {
+  auto changed = false;
+
+#if defined(GB_HOT_RELOAD) && defined(__linux__)
+  if (watch_fd_ >= 0) {
+    auto filename = std::filesystem::path(path_).filename().string();
+    alignas(inotify_event) char buffer[4096];
+
+    for (auto size = read(watch_fd_, buffer, sizeof(buffer)); size > 0; size = read(watch_fd_, buffer, sizeof(buffer))) {
+      for (auto offset = ssize_t{0}; offset < size;) {
+        const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+        if (event->len > 0 && filename == event->name) {
+          changed = true;
+        }
+        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+      }
+    }
+
+    return changed;
+  }
+#endif
+
+  // Без inotify время изменения файла проверяется не чаще раза в полсекунды.
+  if (Clock::now() - last_poll_ < kPollInterval) {
+    return false;
+  }
+  last_poll_ = Clock::now();
+
+  auto write_time = GetWriteTime(path_);
+  changed = write_time != 0 && write_time != last_write_time_;
+  last_write_time_ = write_time;
+  return changed;
+}
+
+} // namespace gb
@@ -0,0 +1,108 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_PLUGINS_SYSTEM_PLUGIN_H
+#define GUIDING_BREEZE_SRC_CORE_PLUGINS_SYSTEM_PLUGIN_H
+
+#include "core/systems/scheduler.hpp"
+#include "core/systems/system.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace gb {
+
+/**
+ * @brief Модуль с системами игрового процесса, перезагружаемый на лету.
+ *
+ * При сборке с GB_HOT_RELOAD (параметр CMake GUIDING_BREEZE_HOT_RELOAD) системы собираются
+ * в отдельную разделяемую библиотеку. Она загружается через SDL_LoadObject, а файл
+ * отслеживается (на Linux через inotify). После изменения файла модуль перезагружается между
+ * кадрами: реестр сущностей сохраняется, заменяются только системы.
+ *
+ * Без GB_HOT_RELOAD системы собираются в ядро, и модуль только вызывает их регистрацию.
+ *
+ * @note Загружается копия файла: так компоновщик может перезаписать модуль, пока он загружен,
+ * а новая версия не совпадает по пути со старой и действительно загружается заново.
+ */
+class SystemPlugin final {
+public:
+  /**
+   * @brief Статистика модуля.
+   */
+  struct Stats {
+    uint32_t reloads{0};      //< Количество успешных перезагрузок
+    uint32_t failures{0};     //< Количество неудачных загрузок
+    size_t systems{0};        //< Количество систем модуля
+    double last_load_ms{0.0}; //< Длительность последней загрузки
+  };
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+private:
+  std::string path_;              //< Путь к файлу модуля
+  Scheduler* scheduler_;          //< Планировщик, в который добавляются системы
+  entt::registry* registry_;      //< Реестр сущностей игры
+  void* handle_{nullptr};         //< Загруженная библиотека
+  std::vector<System*> systems_;  //< Системы модуля в планировщике
+  uint32_t generation_{0};        //< Номер загрузки для имени копии файла
+  int watch_fd_{-1};              //< Дескриптор inotify
+  bool change_pending_{false};    //< Файл изменился и ожидает перезагрузки
+  Clock::time_point last_change_; //< Время последнего изменения файла
+  Clock::time_point last_poll_;   //< Время последней проверки файла без inotify
+  int64_t last_write_time_{0};    //< Время изменения файла при последней проверке без inotify
+  Stats stats_;                   //< Статистика
+
+public:
+  /**
+   * @param path Путь к файлу модуля.
+   * @param scheduler Планировщик систем игры.
+   * @param registry Реестр сущностей игры.
+   */
+  SystemPlugin(std::string path, Scheduler* scheduler, entt::registry* registry);
+  SystemPlugin(const SystemPlugin&) = delete;
+  SystemPlugin(SystemPlugin&&) = delete;
+  ~SystemPlugin() noexcept;
+
+public:
+  SystemPlugin& operator=(const SystemPlugin&) = delete;
+  SystemPlugin& operator=(SystemPlugin&&) = delete;
+
+public:
+  /**
+   * @brief Загрузить модуль или загрузить его заново.
+   *
+   * @return true Если модуль загружен; при ошибке прежняя версия продолжает работать.
+   * @note Вызывается из главного потока между тиками.
+   */
+  bool Load();
+
+  /**
+   * @brief Проверить, изменился ли файл модуля, и перезагрузить его.
+   *
+   * Перезагрузка выполняется, когда файл не меняется дольше 200 мс: компоновщик пишет его не сразу.
+   *
+   * @return true Если модуль перезагружен; кадр при этом мог занять заметно больше времени.
+   * @note Вызывается между кадрами из главного потока.
+   */
+  bool Update();
+
+  /**
+   * @brief Удалить системы модуля и выгрузить его.
+   */
+  void Unload();
+
+  [[nodiscard]] const std::string& GetPath() const;
+
+  [[nodiscard]] const Stats& GetStats() const;
+
+private:
+  void RemoveSystems();
+  [[nodiscard]] bool PollChanges();
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_PLUGINS_SYSTEM_PLUGIN_H
@@ -0,0 +1,146 @@
+#include "font_atlas.hpp"
+
+#include "logger/logger.hpp"
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "SDL_error.h"
+#include "imgui.h"
+
+namespace gb {
+
+namespace {
+
+  constexpr int kBytesPerPixel = 4; //< Размер пикселя RGBA32
+
+  /**
+   * @brief Преобразовать глиф ImGui в глиф атласа.
+   */
+  [[nodiscard]] FontAtlas::Glyph ToGlyph(const ImFontGlyph& glyph) {
+    return FontAtlas::Glyph{
+      glyph.X0, glyph.Y0, glyph.X1, glyph.Y1, glyph.U0, glyph.V0, glyph.U1, glyph.V1, glyph.AdvanceX, glyph.Visible != 0
+    };
+  }
+
+} // namespace
+
+FontAtlas::~FontAtlas() noexcept {
+  if (texture_) {
+    SDL_DestroyTexture(texture_);
+  }
+}
+
+bool FontAtlas::Bake(std::span<const std::byte> ttf, std::span<const float> sizes) {
+  GB_PROFILE_ZONE("Запекание шрифта");
+  assert(!sizes.empty());
+
+  std::vector<float> sorted(sizes.begin(), sizes.end());
+  std::sort(sorted.begin(), sorted.end());
+
+  // Отдельный построитель: общий атлас ImGui принадлежит главному потоку и контексту интерфейса.
+  ImFontAtlas atlas;
+  atlas.Flags |= ImFontAtlasFlags_NoMouseCursors | ImFontAtlasFlags_NoBakedLines;
+
+  // Размеры запекаются точно и выводятся в целых пикселях, поэтому сглаживание со сдвигом не нужно.
+  ImFontConfig config;
+  config.FontDataOwnedByAtlas = false;
+  config.OversampleH = 1;
+  config.OversampleV = 1;
+  config.PixelSnapH = true;
+
+  std::vector<ImFont*> fonts;
+  for (auto size : sorted) {
+    auto* data = const_cast<std::byte*>(ttf.data());
+    fonts.push_back(
+      atlas.AddFontFromMemoryTTF(data, static_cast<int>(ttf.size()), size, &config, atlas.GetGlyphRangesCyrillic())
+    );
+  }
+
+  if (!atlas.Build()) {
+    Logger::Error("Не удалось запечь атлас шрифта.");
+    return false;
+  }
+
+  unsigned char* pixels = nullptr;
+  atlas.GetTexDataAsRGBA32(&pixels, &width_, &height_);
+  pixels_.assign(pixels, pixels + static_cast<size_t>(width_) * height_ * kBytesPerPixel);
+
+  faces_.clear();
+  faces_.reserve(fonts.size());
+  for (const auto* font : fonts) {
+    auto& face = faces_.emplace_back();
+    face.size = font->FontSize;
+    face.line_height = std::ceil(font->FontSize);
+    face.glyphs.reserve(static_cast<size_t>(font->Glyphs.Size));
+
+    for (const auto& glyph : font->Glyphs) {
+      face.glyphs.emplace(static_cast<uint32_t>(glyph.Codepoint), ToGlyph(glyph));
+    }
+
+    face.fallback = font->FallbackGlyph ? ToGlyph(*font->FallbackGlyph) : Glyph{};
+  }
+
+  return true;
+}
+
+bool FontAtlas::Upload(SDL_Renderer* renderer) {
+  assert(renderer);
+  assert(!pixels_.empty() && !texture_);
+
+  texture_ = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width_, height_);
+  if (!texture_) {
+    Logger::Error("Не удалось создать текстуру атласа шрифта: {}", SDL_GetError());
+    return false;
+  }
+
+  SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
+  SDL_UpdateTexture(texture_, nullptr, pixels_.data(), width_ * kBytesPerPixel);
+
+  pixels_.clear();
+  pixels_.shrink_to_fit();
+  return true;
+}
+
+size_t FontAtlas::FindFace(float size) const {
+  assert(!faces_.empty());
+
+  auto best = size_t{0};
+  for (auto i = size_t{1}; i < faces_.size(); i++) {
+    if (std::abs(faces_[i].size - size) < std::abs(faces_[best].size - size)) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+const FontAtlas::Face& FontAtlas::GetFace(size_t index) const {
+  assert(index < faces_.size());
+  return faces_[index];
+}
+
+const FontAtlas::Glyph& FontAtlas::FindGlyph(size_t face, uint32_t codepoint) const {
+  const auto& glyphs = GetFace(face).glyphs;
+  auto it = glyphs.find(codepoint);
+  return it != glyphs.end() ? it->second : faces_[face].fallback;
+}
+
+size_t FontAtlas::GetFaceCount() const {
+  return faces_.size();
+}
+
+SDL_Texture* FontAtlas::GetTexture() const {
+  return texture_;
+}
+
+int FontAtlas::GetWidth() const {
+  return width_;
+}
+
+int FontAtlas::GetHeight() const {
+  return height_;
+}
+
+} // namespace gb
@@ -0,0 +1,113 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_RENDER_FONT_ATLAS_H
+#define GUIDING_BREEZE_SRC_CORE_RENDER_FONT_ATLAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "SDL_render.h"
+
+namespace gb {
+
+/**
+ * @brief Атлас глифов шрифта, запеченный заранее для набора размеров.
+ *
+ * Глифы растеризуются построителем атласов ImGui (stb_truetype) в общую текстуру: для каждого
+ * размера - свое начертание с кириллицей. Запекание (Bake) не обращается к отрисовщику и выполняется
+ * в любом потоке, а выгрузка в текстуру (Upload) - в потоке, владеющем отрисовщиком. После выгрузки
+ * атлас не изменяется, поэтому читается из любого потока.
+ */
+class FontAtlas final {
+public:
+  /**
+   * @brief Глиф начертания.
+   */
+  struct Glyph {
+    float x0;      //< Левая граница относительно позиции пера
+    float y0;      //< Верхняя граница относительно верха строки
+    float x1;      //< Правая граница относительно позиции пера
+    float y1;      //< Нижняя граница относительно верха строки
+    float u0;      //< Текстурная координата левой границы
+    float v0;      //< Текстурная координата верхней границы
+    float u1;      //< Текстурная координата правой границы
+    float v1;      //< Текстурная координата нижней границы
+    float advance; //< Сдвиг пера после глифа
+    bool visible;  //< Глиф имеет изображение; пробелы только сдвигают перо
+  };
+
+  /**
+   * @brief Начертание одного размера.
+   */
+  struct Face {
+    float size;                                 //< Размер в пикселях
+    float line_height;                          //< Высота строки в пикселях
+    std::unordered_map<uint32_t, Glyph> glyphs; //< Глифы по кодовым точкам
+    Glyph fallback;                             //< Глиф для отсутствующих символов
+  };
+
+private:
+  std::vector<Face> faces_;       //< Начертания по возрастанию размера
+  std::vector<uint8_t> pixels_;   //< Изображение атласа RGBA32 до выгрузки в текстуру
+  int width_{0};                  //< Ширина атласа в пикселях
+  int height_{0};                 //< Высота атласа в пикселях
+  SDL_Texture* texture_{nullptr}; //< Текстура атласа
+
+public:
+  FontAtlas() = default;
+  FontAtlas(const FontAtlas&) = delete;
+  FontAtlas(FontAtlas&&) = delete;
+  ~FontAtlas() noexcept;
+
+public:
+  FontAtlas& operator=(const FontAtlas&) = delete;
+  FontAtlas& operator=(FontAtlas&&) = delete;
+
+public:
+  /**
+   * @brief Растеризовать глифы шрифта для заданных размеров.
+   *
+   * @param ttf Содержимое файла шрифта TrueType.
+   * @param sizes Размеры в пикселях.
+   * @return true Если атлас построен.
+   */
+  bool Bake(std::span<const std::byte> ttf, std::span<const float> sizes);
+
+  /**
+   * @brief Выгрузить запеченный атлас в текстуру и освободить его изображение.
+   *
+   * @param renderer Отрисовщик.
+   * @return true Если текстура создана.
+   * @note Вызывается из потока, владеющего отрисовщиком, до уничтожения которого атлас должен быть уничтожен.
+   */
+  bool Upload(SDL_Renderer* renderer);
+
+  /**
+   * @brief Найти начертание, ближайшее к размеру.
+   *
+   * @return size_t Индекс начертания.
+   */
+  [[nodiscard]] size_t FindFace(float size) const;
+
+  [[nodiscard]] const Face& GetFace(size_t index) const;
+
+  /**
+   * @brief Найти глиф кодовой точки.
+   *
+   * @return const Glyph& Глиф, либо заменяющий глиф начертания, если символа в атласе нет.
+   */
+  [[nodiscard]] const Glyph& FindGlyph(size_t face, uint32_t codepoint) const;
+
+  [[nodiscard]] size_t GetFaceCount() const;
+
+  [[nodiscard]] SDL_Texture* GetTexture() const;
+
+  [[nodiscard]] int GetWidth() const;
+
+  [[nodiscard]] int GetHeight() const;
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_RENDER_FONT_ATLAS_H
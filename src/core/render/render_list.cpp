@@ -0,0 +1,67 @@
+#include "render_list.hpp"
+
+namespace gb {
+
+namespace {
+
+  constexpr size_t kVerticesPerQuad = 4; //< Количество вершин прямоугольника
+  constexpr size_t kIndicesPerQuad = 6;  //< Количество индексов прямоугольника (два треугольника)
+
+} // namespace
+
+void RenderList::Reset(int width, int height, Color clear_color) {
+  vertices_.clear();
+  commands_.clear();
+  clear_color_ = clear_color;
+  width_ = width;
+  height_ = height;
+}
+
+std::span<RenderList::Vertex> RenderList::AddQuads(void* texture, BlendMode blend_mode, size_t quad_count) {
+  if (commands_.empty() || commands_.back().texture != texture || commands_.back().blend_mode != blend_mode) {
+    commands_.push_back({texture, blend_mode, static_cast<uint32_t>(vertices_.size()), 0});
+  }
+
+  auto& command = commands_.back();
+  command.quad_count += static_cast<uint32_t>(quad_count);
+
+  // Индексы команды отсчитываются от ее первой вершины, поэтому шаблон растет только под самую большую команду.
+  auto quads = indices_.size() / kIndicesPerQuad;
+  if (quads < command.quad_count) {
+    indices_.reserve(command.quad_count * kIndicesPerQuad);
+    for (auto quad = quads; quad < command.quad_count; quad++) {
+      auto base = static_cast<int32_t>(quad * kVerticesPerQuad);
+      indices_.insert(indices_.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+    }
+  }
+
+  auto first = vertices_.size();
+  vertices_.resize(first + quad_count * kVerticesPerQuad);
+  return {vertices_.data() + first, quad_count * kVerticesPerQuad};
+}
+
+std::span<const RenderList::Vertex> RenderList::GetVertices() const {
+  return vertices_;
+}
+
+std::span<const int32_t> RenderList::GetIndices() const {
+  return indices_;
+}
+
+std::span<const RenderList::Command> RenderList::GetCommands() const {
+  return commands_;
+}
+
+RenderList::Color RenderList::GetClearColor() const {
+  return clear_color_;
+}
+
+int RenderList::GetWidth() const {
+  return width_;
+}
+
+int RenderList::GetHeight() const {
+  return height_;
+}
+
+} // namespace gb
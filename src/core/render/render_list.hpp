@@ -0,0 +1,130 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_RENDER_RENDER_LIST_H
+#define GUIDING_BREEZE_SRC_CORE_RENDER_RENDER_LIST_H
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace gb {
+
+/**
+ * @brief Список команд отрисовки кадра, не зависящий от графического API.
+ *
+ * Извлечение отрисовки записывает в список геометрию из реестра, а поток, владеющий отрисовщиком,
+ * воспроизводит его (см. RenderSubmit). Список не обращается к отрисовщику, поэтому заполняется
+ * в любом потоке; буферы переиспользуются между кадрами.
+ *
+ * @note Текстуры хранятся непрозрачными указателями и должны существовать до воспроизведения списка.
+ */
+class RenderList final {
+public:
+  /**
+   * @brief Режим смешивания команды.
+   */
+  enum class BlendMode : u_short {
+    None,     //< Без смешивания
+    Blend,    //< Альфа-смешивание
+    Add,      //< Сложение
+    Modulate, //< Умножение цвета
+    Multiply, //< Умножение с учетом альфа-канала
+  };
+
+  /**
+   * @brief Вершина; совпадает по расположению с SDL_Vertex.
+   */
+  struct Vertex {
+    float x;   //< Позиция по X в пикселях
+    float y;   //< Позиция по Y в пикселях
+    uint8_t r; //< Красный канал цвета
+    uint8_t g; //< Зеленый канал цвета
+    uint8_t b; //< Синий канал цвета
+    uint8_t a; //< Альфа-канал цвета
+    float u;   //< Текстурная координата по X
+    float v;   //< Текстурная координата по Y
+  };
+
+  /**
+   * @brief Команда отрисовки прямоугольников с одним набором состояний.
+   */
+  struct Command {
+    void* texture;         //< Текстура; nullptr - сплошная заливка цветом
+    BlendMode blend_mode;  //< Режим смешивания
+    uint32_t first_vertex; //< Индекс первой вершины команды; индексы отсчитываются от нее
+    uint32_t quad_count;   //< Количество прямоугольников
+  };
+
+  /**
+   * @brief Цвет очистки кадра.
+   */
+  struct Color {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+  };
+
+private:
+  std::vector<Vertex> vertices_;    //< Вершины всех команд
+  std::vector<int32_t> indices_;    //< Общий для всех команд шаблон индексов прямоугольников
+  std::vector<Command> commands_;   //< Команды в порядке отрисовки
+  Color clear_color_{0, 0, 0, 255}; //< Цвет очистки кадра
+  int width_{0};                    //< Ширина области вывода в пикселях
+  int height_{0};                   //< Высота области вывода в пикселях
+
+public:
+  RenderList() = default;
+  RenderList(const RenderList&) = delete;
+  RenderList(RenderList&&) = default;
+  ~RenderList() noexcept = default;
+
+public:
+  RenderList& operator=(const RenderList&) = delete;
+  RenderList& operator=(RenderList&&) = default;
+
+public:
+  /**
+   * @brief Начать новый кадр: удалить команды, сохранив память буферов.
+   *
+   * @param width Ширина области вывода; по ней извлечение отсекает невидимое.
+   * @param height Высота области вывода.
+   * @param clear_color Цвет очистки кадра.
+   */
+  void Reset(int width, int height, Color clear_color = {0, 0, 0, 255});
+
+  /**
+   * @brief Добавить прямоугольники и вернуть их вершины для заполнения.
+   *
+   * Прямоугольники с теми же состояниями, что и у последней команды, добавляются в нее.
+   *
+   * @param texture Текстура прямоугольников.
+   * @param blend_mode Режим смешивания.
+   * @param quad_count Количество прямоугольников.
+   * @return std::span<Vertex> По 4 вершины на прямоугольник по часовой стрелке от левого верхнего угла;
+   * действительны до следующего изменения списка.
+   */
+  [[nodiscard]] std::span<Vertex> AddQuads(void* texture, BlendMode blend_mode, size_t quad_count);
+
+  [[nodiscard]] std::span<const Vertex> GetVertices() const;
+
+  /**
+   * @brief Получить шаблон индексов прямоугольников.
+   *
+   * @return std::span<const int32_t> Индексы для самой большой команды; команда использует первые
+   * quad_count * 6 из них относительно своей первой вершины.
+   */
+  [[nodiscard]] std::span<const int32_t> GetIndices() const;
+
+  [[nodiscard]] std::span<const Command> GetCommands() const;
+
+  [[nodiscard]] Color GetClearColor() const;
+
+  [[nodiscard]] int GetWidth() const;
+
+  [[nodiscard]] int GetHeight() const;
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_RENDER_RENDER_LIST_H
@@ -0,0 +1,83 @@
+#include "render_submit.hpp"
+
+#include "profiler/profiler.hpp"
+
+#include <cstddef>
+
+namespace gb::RenderSubmit {
+
+namespace {
+
+  constexpr size_t kVerticesPerQuad = 4; //< Количество вершин прямоугольника
+  constexpr size_t kIndicesPerQuad = 6;  //< Количество индексов прямоугольника (два треугольника)
+
+  // Вершины списка передаются в SDL_RenderGeometry без копирования.
+  static_assert(sizeof(RenderList::Vertex) == sizeof(SDL_Vertex));
+  static_assert(offsetof(RenderList::Vertex, x) == offsetof(SDL_Vertex, position));
+  static_assert(offsetof(RenderList::Vertex, r) == offsetof(SDL_Vertex, color));
+  static_assert(offsetof(RenderList::Vertex, u) == offsetof(SDL_Vertex, tex_coord));
+
+} // namespace
+
+void Submit(SDL_Renderer* renderer, const RenderList& list) {
+  auto clear_color = list.GetClearColor();
+  SDL_SetRenderDrawColor(renderer, clear_color.r, clear_color.g, clear_color.b, clear_color.a);
+  SDL_RenderClear(renderer);
+
+  SubmitCommands(renderer, list);
+}
+
+void SubmitCommands(SDL_Renderer* renderer, const RenderList& list) {
+  GB_PROFILE_ZONE("Воспроизведение команд");
+
+  const auto* vertices = reinterpret_cast<const SDL_Vertex*>(list.GetVertices().data());
+  const auto* indices = list.GetIndices().data();
+
+  for (const auto& command : list.GetCommands()) {
+    auto* texture = static_cast<SDL_Texture*>(command.texture);
+    auto blend_mode = ToSdlBlendMode(command.blend_mode);
+
+    if (texture != nullptr) {
+      SDL_SetTextureBlendMode(texture, blend_mode);
+    } else {
+      SDL_SetRenderDrawBlendMode(renderer, blend_mode);
+    }
+
+    SDL_RenderGeometry(
+      renderer, texture, vertices + command.first_vertex, static_cast<int>(command.quad_count * kVerticesPerQuad),
+      indices, static_cast<int>(command.quad_count * kIndicesPerQuad)
+    );
+  }
+}
+
+RenderList::BlendMode ToBlendMode(SDL_BlendMode blend_mode) {
+  switch (blend_mode) {
+    case SDL_BLENDMODE_BLEND:
+      return RenderList::BlendMode::Blend;
+    case SDL_BLENDMODE_ADD:
+      return RenderList::BlendMode::Add;
+    case SDL_BLENDMODE_MOD:
+      return RenderList::BlendMode::Modulate;
+    case SDL_BLENDMODE_MUL:
+      return RenderList::BlendMode::Multiply;
+    default:
+      return RenderList::BlendMode::None;
+  }
+}
+
+SDL_BlendMode ToSdlBlendMode(RenderList::BlendMode blend_mode) {
+  switch (blend_mode) {
+    case RenderList::BlendMode::Blend:
+      return SDL_BLENDMODE_BLEND;
+    case RenderList::BlendMode::Add:
+      return SDL_BLENDMODE_ADD;
+    case RenderList::BlendMode::Modulate:
+      return SDL_BLENDMODE_MOD;
+    case RenderList::BlendMode::Multiply:
+      return SDL_BLENDMODE_MUL;
+    default:
+      return SDL_BLENDMODE_NONE;
+  }
+}
+
+} // namespace gb::RenderSubmit
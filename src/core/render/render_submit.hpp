@@ -0,0 +1,41 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_RENDER_RENDER_SUBMIT_H
+#define GUIDING_BREEZE_SRC_CORE_RENDER_RENDER_SUBMIT_H
+
+#include "core/render/render_list.hpp"
+
+#include "SDL_blendmode.h"
+#include "SDL_render.h"
+
+namespace gb::RenderSubmit {
+
+/**
+ * @brief Очистить кадр цветом списка и воспроизвести его команды.
+ *
+ * @param renderer Отрисовщик SDL.
+ * @param list Список команд кадра.
+ * @note Вызывается только из потока, владеющего отрисовщиком.
+ */
+void Submit(SDL_Renderer* renderer, const RenderList& list);
+
+/**
+ * @brief Воспроизвести команды списка поверх уже нарисованного, по вызову SDL_RenderGeometry на команду.
+ *
+ * @param renderer Отрисовщик SDL.
+ * @param list Список команд.
+ * @note Вызывается только из потока, владеющего отрисовщиком.
+ */
+void SubmitCommands(SDL_Renderer* renderer, const RenderList& list);
+
+/**
+ * @brief Перевести режим смешивания SDL в режим списка команд.
+ */
+[[nodiscard]] RenderList::BlendMode ToBlendMode(SDL_BlendMode blend_mode);
+
+/**
+ * @brief Перевести режим смешивания списка команд в режим SDL.
+ */
+[[nodiscard]] SDL_BlendMode ToSdlBlendMode(RenderList::BlendMode blend_mode);
+
+} // namespace gb::RenderSubmit
+
+#endif // GUIDING_BREEZE_SRC_CORE_RENDER_RENDER_SUBMIT_H
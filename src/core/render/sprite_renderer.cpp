@@ -0,0 +1,128 @@
+#include "sprite_renderer.hpp"
+
+#include "core/components/sprite_component.hpp"
+#include "core/components/transform_component.hpp"
+#include "core/render/render_submit.hpp"
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+namespace gb {
+
+namespace {
+
+  constexpr size_t kIndicesPerQuad = 6; //< Количество индексов прямоугольника (два треугольника)
+
+} // namespace
+
+void SpriteRenderer::Extract(const entt::registry& registry, RenderList& list) {
+  GB_PROFILE_ZONE("Спрайты");
+
+  Collect(registry);
+  Build(registry, list);
+}
+
+void SpriteRenderer::Extract(const entt::registry& registry, std::span<const entt::entity> entities, RenderList& list) {
+  GB_PROFILE_ZONE("Спрайты");
+
+  Collect(registry, entities);
+  Build(registry, list);
+}
+
+void SpriteRenderer::Render(SDL_Renderer* renderer, const entt::registry& registry) {
+  list_.Reset(0, 0);
+  Extract(registry, list_);
+  RenderSubmit::SubmitCommands(renderer, list_);
+}
+
+void SpriteRenderer::Render(SDL_Renderer* renderer, const entt::registry& registry, std::span<const entt::entity> entities) {
+  list_.Reset(0, 0);
+  Extract(registry, entities, list_);
+  RenderSubmit::SubmitCommands(renderer, list_);
+}
+
+const SpriteRenderer::Stats& SpriteRenderer::GetStats() const {
+  return stats_;
+}
+
+void SpriteRenderer::Collect(const entt::registry& registry) {
+  items_.clear();
+
+  auto view = registry.view<const TransformComponent, const SpriteComponent>();
+
+  for (auto [entity, transform, sprite] : view.each()) {
+    items_.push_back({sprite.layer, sprite.blend_mode, sprite.texture, entt::to_entity(entity), entity});
+  }
+
+  Sort();
+}
+
+void SpriteRenderer::Collect(const entt::registry& registry, std::span<const entt::entity> entities) {
+  items_.clear();
+
+  auto view = registry.view<const TransformComponent, const SpriteComponent>();
+
+  for (auto entity : entities) {
+    if (!view.contains(entity)) {
+      continue;
+    }
+
+    const auto& sprite = view.get<const SpriteComponent>(entity);
+    items_.push_back({sprite.layer, sprite.blend_mode, sprite.texture, entt::to_entity(entity), entity});
+  }
+
+  Sort();
+}
+
+void SpriteRenderer::Sort() {
+  // Слой определяет порядок наложения, поэтому сортируется первым; внутри слоя спрайты
+  // группируются по состояниям, чтобы получить как можно меньше пакетов.
+  std::sort(items_.begin(), items_.end(), [](const Item& lhs, const Item& rhs) {
+    return std::tie(lhs.layer, lhs.blend_mode, lhs.texture, lhs.order)
+         < std::tie(rhs.layer, rhs.blend_mode, rhs.texture, rhs.order);
+  });
+}
+
+void SpriteRenderer::Build(const entt::registry& registry, RenderList& list) {
+  stats_ = Stats{};
+
+  auto view = registry.view<const TransformComponent, const SpriteComponent>();
+
+  for (auto first = items_.begin(); first != items_.end();) {
+    // Спрайты с одинаковыми состояниями идут подряд после сортировки и записываются одной командой
+    auto last = std::find_if(first, items_.end(), [&first](const Item& item) {
+      return item.texture != first->texture || item.blend_mode != first->blend_mode;
+    });
+
+    auto quad_count = static_cast<size_t>(last - first);
+    auto commands = list.GetCommands().size();
+    auto vertices = list.AddQuads(first->texture, RenderSubmit::ToBlendMode(first->blend_mode), quad_count);
+    auto* vertex = vertices.data();
+
+    for (; first != last; ++first) {
+      const auto& [transform, sprite] = view.get(first->entity);
+      auto left = transform.x;
+      auto top = transform.y;
+      auto right = left + sprite.width;
+      auto bottom = top + sprite.height;
+      auto u0 = sprite.uv.x;
+      auto v0 = sprite.uv.y;
+      auto u1 = u0 + sprite.uv.w;
+      auto v1 = v0 + sprite.uv.h;
+      auto [r, g, b, a] = sprite.color;
+
+      *vertex++ = {left, top, r, g, b, a, u0, v0};
+      *vertex++ = {right, top, r, g, b, a, u1, v0};
+      *vertex++ = {right, bottom, r, g, b, a, u1, v1};
+      *vertex++ = {left, bottom, r, g, b, a, u0, v1};
+    }
+
+    stats_.sprites += quad_count;
+    stats_.draw_calls += list.GetCommands().size() - commands;
+    stats_.vertices += vertices.size();
+    stats_.indices += quad_count * kIndicesPerQuad;
+  }
+}
+
+} // namespace gb
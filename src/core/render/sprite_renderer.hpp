@@ -0,0 +1,111 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_RENDER_SPRITE_RENDERER_H
+#define GUIDING_BREEZE_SRC_CORE_RENDER_SPRITE_RENDERER_H
+
+#include "core/render/render_list.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "SDL_blendmode.h"
+#include "SDL_render.h"
+#include "entt/entt.hpp"
+
+namespace gb {
+
+/**
+ * @brief Пакетный отрисовщик спрайтов.
+ *
+ * Каждый кадр собирает сущности с TransformComponent и SpriteComponent, сортирует их
+ * по слою, режиму смешивания и текстуре и записывает каждую группу одинаковых состояний
+ * одной командой RenderList, которая воспроизводится одним вызовом SDL_RenderGeometry.
+ * Буферы переиспользуются между кадрами.
+ *
+ * Извлечение (Extract) не обращается к отрисовщику и может выполняться вне потока, владеющего им.
+ */
+class SpriteRenderer final {
+public:
+  /**
+   * @brief Статистика последнего кадра.
+   */
+  struct Stats {
+    size_t sprites;    //< Количество отрисованных спрайтов
+    size_t draw_calls; //< Количество команд (вызовов SDL_RenderGeometry)
+    size_t vertices;   //< Количество записанных вершин
+    size_t indices;    //< Количество индексов в вызовах отрисовки
+  };
+
+private:
+  struct Item {
+    int32_t layer;            //< Слой спрайта
+    SDL_BlendMode blend_mode; //< Режим смешивания
+    SDL_Texture* texture;     //< Текстура
+    uint32_t order;           //< Индекс сущности; сохраняет порядок равных спрайтов между кадрами
+    entt::entity entity;      //< Сущность спрайта
+  };
+
+private:
+  std::vector<Item> items_; //< Отсортированные спрайты кадра
+  RenderList list_;         //< Список команд для немедленной отрисовки через Render
+  Stats stats_{};           //< Статистика последнего кадра
+
+public:
+  SpriteRenderer() = default;
+  SpriteRenderer(const SpriteRenderer&) = delete;
+  SpriteRenderer(SpriteRenderer&&) = default;
+  ~SpriteRenderer() noexcept = default;
+
+public:
+  SpriteRenderer& operator=(const SpriteRenderer&) = delete;
+  SpriteRenderer& operator=(SpriteRenderer&&) = default;
+
+public:
+  /**
+   * @brief Записать все спрайты реестра в список команд.
+   *
+   * @param registry Реестр сущностей.
+   * @param list Список команд кадра; спрайты добавляются после уже записанных команд.
+   */
+  void Extract(const entt::registry& registry, RenderList& list);
+
+  /**
+   * @brief Записать в список команд спрайты только из заданного набора сущностей.
+   *
+   * @param registry Реестр сущностей.
+   * @param entities Сущности, например видимые по запросу к SpatialGrid; сущности без спрайта пропускаются.
+   * @param list Список команд кадра; спрайты добавляются после уже записанных команд.
+   */
+  void Extract(const entt::registry& registry, std::span<const entt::entity> entities, RenderList& list);
+
+  /**
+   * @brief Сразу отрисовать все спрайты реестра.
+   *
+   * @param renderer Отрисовщик SDL.
+   * @param registry Реестр сущностей.
+   */
+  void Render(SDL_Renderer* renderer, const entt::registry& registry);
+
+  /**
+   * @brief Сразу отрисовать спрайты только из заданного набора сущностей.
+   *
+   * @param renderer Отрисовщик SDL.
+   * @param registry Реестр сущностей.
+   * @param entities Сущности, например видимые по запросу к SpatialGrid; сущности без спрайта пропускаются.
+   */
+  void Render(SDL_Renderer* renderer, const entt::registry& registry, std::span<const entt::entity> entities);
+
+  /**
+   * @brief Получить статистику последнего кадра.
+   */
+  [[nodiscard]] const Stats& GetStats() const;
+
+private:
+  void Collect(const entt::registry& registry);
+  void Collect(const entt::registry& registry, std::span<const entt::entity> entities);
+  void Sort();
+  void Build(const entt::registry& registry, RenderList& list);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_RENDER_SPRITE_RENDERER_H
@@ -0,0 +1,276 @@
+#include "text_renderer.hpp"
+
+#include "core/components/transform_component.hpp"
+#include "core/jobs/task.hpp"
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace gb {
+
+namespace {
+
+  constexpr uint64_t kEvictFrames = 300;             //< Через сколько кадров без вывода раскладка удаляется из кэша
+  constexpr uint64_t kEvictInterval = 60;            //< Период проверки кэша в кадрах
+  constexpr uint32_t kReplacementCharacter = 0xFFFD; //< Символ для некорректных последовательностей UTF-8
+
+  /**
+   * @brief Прочитать кодовую точку из UTF-8.
+   *
+   * @param text Текст.
+   * @param offset Смещение первого байта; сдвигается за прочитанную последовательность.
+   * @return uint32_t Кодовая точка, либо kReplacementCharacter для некорректной последовательности.
+   */
+  [[nodiscard]] uint32_t DecodeUtf8(std::string_view text, size_t& offset) {
+    auto lead = static_cast<uint8_t>(text[offset++]);
+    if (lead < 0x80) {
+      return lead;
+    }
+
+    auto extra = size_t{0};
+    auto codepoint = uint32_t{0};
+    if ((lead & 0xE0) == 0xC0) {
+      extra = 1;
+      codepoint = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+      extra = 2;
+      codepoint = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+      extra = 3;
+      codepoint = lead & 0x07;
+    } else {
+      return kReplacementCharacter;
+    }
+
+    for (auto i = size_t{0}; i < extra; i++) {
+      if (offset >= text.size() || (static_cast<uint8_t>(text[offset]) & 0xC0) != 0x80) {
+        return kReplacementCharacter;
+      }
+      codepoint = (codepoint << 6) | (static_cast<uint8_t>(text[offset++]) & 0x3F);
+    }
+
+    return codepoint;
+  }
+
+  /**
+   * @brief Получить ключ раскладки в кэше.
+   */
+  [[nodiscard]] uint64_t GetRunKey(std::string_view text, size_t face) {
+    return std::hash<std::string_view>{}(text) ^ (static_cast<uint64_t>(face + 1) * 0x9E3779B97F4A7C15ULL);
+  }
+
+  /**
+   * @brief Доля ширины надписи, на которую она сдвигается влево при выравнивании.
+   */
+  [[nodiscard]] float GetAlignFactor(TextAlign align) {
+    switch (align) {
+      case TextAlign::Center:
+        return 0.5F;
+      case TextAlign::Right:
+        return 1.0F;
+      default:
+        return 0.0F;
+    }
+  }
+
+  /**
+   * @brief Запечь атлас шрифта в пуле потоков.
+   *
+   * @param ttf Копия файла шрифта: задача не зависит от времени жизни ресурса.
+   * @param sizes Размеры в пикселях.
+   */
+  Task<std::unique_ptr<FontAtlas>> BakeAtlas(std::vector<std::byte> ttf, std::vector<float> sizes) {
+    auto atlas = std::make_unique<FontAtlas>();
+    if (!atlas->Bake(ttf, sizes)) {
+      co_return nullptr;
+    }
+    co_return std::move(atlas);
+  }
+
+} // namespace
+
+void TextRenderer::Load(std::string_view path, std::vector<float> sizes, TaskScheduler* tasks) {
+  assert(tasks && !sizes.empty());
+  assert(!file_.IsValid() && !bake_.IsValid() && !atlas_);
+
+  file_ = Assets::LoadFile(path);
+  sizes_ = std::move(sizes);
+  tasks_ = tasks;
+}
+
+void TextRenderer::Update(SDL_Renderer* renderer) {
+  if (file_.IsValid() && file_.GetState() != Assets::State::Loading) {
+    if (const auto* data = file_.GetData()) {
+      bake_ = tasks_->Launch(BakeAtlas(*data, sizes_), TaskPriority::Low);
+    }
+    file_.Reset();
+  }
+
+  if (bake_.IsReady()) {
+    auto atlas = bake_.Get();
+    if (atlas && atlas->Upload(renderer)) {
+      SetAtlas(std::move(atlas));
+    }
+  }
+}
+
+void TextRenderer::SetAtlas(std::unique_ptr<FontAtlas> atlas) {
+  assert(atlas && !atlas_);
+
+  atlas_ = std::move(atlas);
+  ready_atlas_.store(atlas_.get(), std::memory_order_release);
+}
+
+bool TextRenderer::IsReady() const {
+  return ready_atlas_.load(std::memory_order_acquire) != nullptr;
+}
+
+void TextRenderer::Extract(const entt::registry& registry, RenderList& list) {
+  GB_PROFILE_ZONE("Надписи");
+  BeginFrame();
+
+  const auto* atlas = ready_atlas_.load(std::memory_order_acquire);
+  if (!atlas) {
+    return;
+  }
+
+  for (auto [entity, transform, text] : registry.view<const TransformComponent, const TextComponent>().each()) {
+    const auto& run = Shape(*atlas, text.text, atlas->FindFace(text.size));
+    Emit(*atlas, run, transform.x, transform.y, text.color, text.align, list);
+  }
+}
+
+void TextRenderer::Extract(const entt::registry& registry, std::span<const entt::entity> entities, RenderList& list) {
+  GB_PROFILE_ZONE("Надписи");
+  BeginFrame();
+
+  const auto* atlas = ready_atlas_.load(std::memory_order_acquire);
+  if (!atlas) {
+    return;
+  }
+
+  auto view = registry.view<const TransformComponent, const TextComponent>();
+
+  for (auto entity : entities) {
+    if (!view.contains(entity)) {
+      continue;
+    }
+
+    const auto& transform = view.get<const TransformComponent>(entity);
+    const auto& text = view.get<const TextComponent>(entity);
+    const auto& run = Shape(*atlas, text.text, atlas->FindFace(text.size));
+    Emit(*atlas, run, transform.x, transform.y, text.color, text.align, list);
+  }
+}
+
+void TextRenderer::Draw(
+  RenderList& list, std::string_view text, float x, float y, float size, SDL_Color color, TextAlign align
+) {
+  const auto* atlas = ready_atlas_.load(std::memory_order_acquire);
+  if (!atlas) {
+    return;
+  }
+
+  const auto& run = Shape(*atlas, text, atlas->FindFace(size));
+  Emit(*atlas, run, x, y, color, align, list);
+}
+
+void TextRenderer::ClearCache() {
+  runs_.clear();
+  stats_.cached = 0;
+}
+
+const TextRenderer::Stats& TextRenderer::GetStats() const {
+  return stats_;
+}
+
+void TextRenderer::BeginFrame() {
+  frame_++;
+  stats_.labels = 0;
+  stats_.glyphs = 0;
+  stats_.shaped = 0;
+
+  if (frame_ % kEvictInterval == 0) {
+    stats_.evicted += std::erase_if(runs_, [this](const auto& item) {
+      return frame_ - item.second.last_used > kEvictFrames;
+    });
+    stats_.cached = runs_.size();
+  }
+}
+
+const TextRenderer::Run& TextRenderer::Shape(const FontAtlas& atlas, std::string_view text, size_t face) {
+  auto& run = runs_[GetRunKey(text, face)];
+  run.last_used = frame_;
+
+  if (run.face == face && run.text == text) {
+    return run;
+  }
+
+  // Новая надпись или совпадение хэшей: раскладка строится заново.
+  stats_.shaped++;
+  run.text.assign(text);
+  run.face = face;
+  run.quads.clear();
+
+  auto line_height = atlas.GetFace(face).line_height;
+  auto pen_x = 0.0F;
+  auto pen_y = 0.0F;
+  auto width = 0.0F;
+
+  for (auto offset = size_t{0}; offset < text.size();) {
+    auto codepoint = DecodeUtf8(text, offset);
+    if (codepoint == '\n') {
+      width = std::max(width, pen_x);
+      pen_x = 0.0F;
+      pen_y += line_height;
+      continue;
+    }
+
+    const auto& glyph = atlas.FindGlyph(face, codepoint);
+    if (glyph.visible) {
+      run.quads.push_back(Quad{
+        pen_x + glyph.x0, pen_y + glyph.y0, pen_x + glyph.x1, pen_y + glyph.y1, glyph.u0, glyph.v0, glyph.u1, glyph.v1
+      });
+    }
+    pen_x += glyph.advance;
+  }
+
+  run.width = std::max(width, pen_x);
+  run.height = pen_y + line_height;
+  stats_.cached = runs_.size();
+  return run;
+}
+
+void TextRenderer::Emit(
+  const FontAtlas& atlas, const Run& run, float x, float y, SDL_Color color, TextAlign align, RenderList& list
+) {
+  stats_.labels++;
+  if (run.quads.empty()) {
+    return;
+  }
+
+  // Надпись выводится в целых пикселях: глифы запечены без сдвига на доли пикселя.
+  auto origin_x = std::round(x - run.width * GetAlignFactor(align));
+  auto origin_y = std::round(y);
+
+  // Все надписи ссылаются на одну текстуру, поэтому подряд идущие сливаются в одну команду.
+  auto vertices = list.AddQuads(atlas.GetTexture(), RenderList::BlendMode::Blend, run.quads.size());
+  for (auto i = size_t{0}; i < run.quads.size(); i++) {
+    const auto& quad = run.quads[i];
+    auto* vertex = &vertices[i * 4];
+
+    vertex[0] = {origin_x + quad.x0, origin_y + quad.y0, color.r, color.g, color.b, color.a, quad.u0, quad.v0};
+    vertex[1] = {origin_x + quad.x1, origin_y + quad.y0, color.r, color.g, color.b, color.a, quad.u1, quad.v0};
+    vertex[2] = {origin_x + quad.x1, origin_y + quad.y1, color.r, color.g, color.b, color.a, quad.u1, quad.v1};
+    vertex[3] = {origin_x + quad.x0, origin_y + quad.y1, color.r, color.g, color.b, color.a, quad.u0, quad.v1};
+  }
+
+  stats_.glyphs += run.quads.size();
+}
+
+} // namespace gb
@@ -0,0 +1,180 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_RENDER_TEXT_RENDERER_H
+#define GUIDING_BREEZE_SRC_CORE_RENDER_TEXT_RENDERER_H
+
+#include "core/assets/assets.hpp"
+#include "core/components/text_component.hpp"
+#include "core/jobs/task_scheduler.hpp"
+#include "core/render/font_atlas.hpp"
+#include "core/render/render_list.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "SDL_pixels.h"
+#include "SDL_render.h"
+#include "entt/entt.hpp"
+
+namespace gb {
+
+/**
+ * @brief Отрисовщик надписей в мире и интерфейсе игры.
+ *
+ * Шрифт запекается в атлас FontAtlas в пуле потоков для заданных размеров. Раскладка надписи
+ * (глифы со смещениями) кэшируется по хэшу текста и начертанию, поэтому неизменные надписи
+ * не раскладываются заново, а только копируются в вершины. Все надписи используют одну
+ * текстуру, поэтому записываются в RenderList общей командой: тысячи чисел урона или имен
+ * над персонажами выводятся одним вызовом отрисовки.
+ *
+ * Загрузка шрифта (Load, Update) выполняется в потоке, владеющем отрисовщиком, а извлечение
+ * (Extract, Draw) - в потоке симуляции; до готовности атласа надписи пропускаются.
+ */
+class TextRenderer final {
+public:
+  /**
+   * @brief Статистика последнего кадра.
+   */
+  struct Stats {
+    size_t labels;  //< Количество выведенных надписей
+    size_t glyphs;  //< Количество выведенных глифов
+    size_t shaped;  //< Количество надписей, разложенных заново
+    size_t cached;  //< Количество раскладок в кэше
+    size_t evicted; //< Количество раскладок, удаленных из кэша за все время
+  };
+
+private:
+  /**
+   * @brief Прямоугольник глифа относительно начала надписи.
+   */
+  struct Quad {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+  };
+
+  /**
+   * @brief Разложенная надпись.
+   */
+  struct Run {
+    std::string text;        //< Текст; отличает надписи с совпавшим хэшем
+    size_t face{SIZE_MAX};   //< Индекс начертания
+    std::vector<Quad> quads; //< Видимые глифы
+    float width{0.0F};       //< Ширина самой длинной строки
+    float height{0.0F};      //< Высота всех строк
+    uint64_t last_used{0};   //< Кадр последнего вывода
+  };
+
+private:
+  std::unique_ptr<FontAtlas> atlas_;                   //< Атлас шрифта
+  std::atomic<const FontAtlas*> ready_atlas_{nullptr}; //< Атлас после выгрузки в текстуру; читается потоком симуляции
+  Assets::Handle file_;                                //< Файл шрифта до запуска запекания
+  std::vector<float> sizes_;                           //< Запекаемые размеры
+  TaskScheduler* tasks_{nullptr};                      //< Планировщик задач для запекания
+  TaskHandle<std::unique_ptr<FontAtlas>> bake_;        //< Задача запекания
+  std::unordered_map<uint64_t, Run> runs_;             //< Кэш раскладок по хэшу текста и начертания
+  uint64_t frame_{0};                                  //< Номер кадра извлечения
+  Stats stats_{};                                      //< Статистика последнего кадра
+
+public:
+  TextRenderer() = default;
+  TextRenderer(const TextRenderer&) = delete;
+  TextRenderer(TextRenderer&&) = delete;
+  ~TextRenderer() noexcept = default;
+
+public:
+  TextRenderer& operator=(const TextRenderer&) = delete;
+  TextRenderer& operator=(TextRenderer&&) = delete;
+
+public:
+  /**
+   * @brief Запросить шрифт и запечь его в фоне.
+   *
+   * @param path Путь к файлу шрифта TrueType.
+   * @param sizes Размеры в пикселях, для которых запекаются начертания.
+   * @param tasks Планировщик задач, в пуле которого выполняется запекание.
+   * @note Вызывается из главного потока один раз.
+   */
+  void Load(std::string_view path, std::vector<float> sizes, TaskScheduler* tasks);
+
+  /**
+   * @brief Запустить запекание прочитанного шрифта и выгрузить готовый атлас в текстуру.
+   *
+   * @param renderer Отрисовщик.
+   * @note Вызывается из главного потока каждый кадр после Assets::Update.
+   */
+  void Update(SDL_Renderer* renderer);
+
+  /**
+   * @brief Установить готовый атлас, например запеченный заранее без Load.
+   *
+   * @param atlas Атлас; выгруженный в текстуру, либо без нее - тогда глифы выводятся заливкой.
+   * @note Атлас устанавливается один раз: прежний мог бы еще читаться потоком симуляции.
+   */
+  void SetAtlas(std::unique_ptr<FontAtlas> atlas);
+
+  /**
+   * @brief Проверить, готов ли атлас шрифта.
+   */
+  [[nodiscard]] bool IsReady() const;
+
+  /**
+   * @brief Записать все надписи реестра в список команд и начать новый кадр кэша.
+   *
+   * @param registry Реестр сущностей.
+   * @param list Список команд кадра; надписи добавляются после уже записанных команд.
+   */
+  void Extract(const entt::registry& registry, RenderList& list);
+
+  /**
+   * @brief Записать в список команд надписи только из заданного набора сущностей.
+   *
+   * @param registry Реестр сущностей.
+   * @param entities Сущности, например видимые по запросу к SpatialGrid; сущности без надписи пропускаются.
+   * @param list Список команд кадра.
+   */
+  void Extract(const entt::registry& registry, std::span<const entt::entity> entities, RenderList& list);
+
+  /**
+   * @brief Записать надпись без сущности, например текст интерфейса игры.
+   *
+   * @param list Список команд кадра.
+   * @param text Текст в UTF-8.
+   * @param x Позиция по X в пикселях; смысл задает align.
+   * @param y Позиция верха надписи по Y в пикселях.
+   * @param size Размер в пикселях; используется ближайший запеченный.
+   * @param color Цвет текста.
+   * @param align Выравнивание по горизонтали.
+   * @note Вызывается после Extract того же кадра: раскладки, не использованные несколько
+   * секунд, удаляются из кэша.
+   */
+  void Draw(
+    RenderList& list, std::string_view text, float x, float y, float size, SDL_Color color = {255, 255, 255, 255},
+    TextAlign align = TextAlign::Left
+  );
+
+  /**
+   * @brief Удалить все раскладки из кэша.
+   */
+  void ClearCache();
+
+  [[nodiscard]] const Stats& GetStats() const;
+
+private:
+  void BeginFrame();
+  [[nodiscard]] const Run& Shape(const FontAtlas& atlas, std::string_view text, size_t face);
+  void Emit(const FontAtlas& atlas, const Run& run, float x, float y, SDL_Color color, TextAlign align, RenderList& list);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_RENDER_TEXT_RENDERER_H
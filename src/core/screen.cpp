@@ -1,17 +1,178 @@
 #include "screen.hpp"
 
+#include "core/events/game_events.hpp"
 #include "game.hpp"
 #include "logger/logger.hpp"
 
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <unordered_map>
+
 #include "SDL_stdinc.h"
 #include "SDL_video.h"
+#include "fmt/format.h"
 
 namespace gb::Screen {
 
 namespace {
 
+  /**
+   * @brief Режимы одного дисплея.
+   */
+  struct DisplayTable {
+    std::vector<Resolution> resolutions; //< Доступные разрешения без повторов
+    std::vector<std::string> labels;     //< Подписи разрешений для интерфейса
+  };
+
+  /**
+   * @brief Запрошенное изменение разрешения.
+   */
+  struct Request {
+    Resolution resolution; //< Запрашиваемое разрешение
+    DisplayMode mode;      //< Запрашиваемый режим отображения
+  };
+
   Resolution resolution; //< Текущее разрешение экрана
-  std::vector<Resolution> available_resolutions; //< Коллекция доступных разрешений экрана
+  DisplayMode display_mode{DisplayMode::Windowed}; //< Текущий режим отображения
+  std::optional<Request> pending; //< Изменение, ожидающее применения между кадрами
+
+  std::unordered_map<int, DisplayTable> tables; //< Таблицы режимов по индексу дисплея
+  const DisplayTable empty_table; //< Таблица, возвращаемая, если дисплей окна неизвестен
+  const DisplayTable* table{&empty_table}; //< Таблица дисплея, на котором находится окно
+  int active_index{-1}; //< Индекс текущего разрешения в таблице
+  uint32_t revision{0}; //< Номер ревизии таблицы и текущего режима
+  bool stale{true}; //< Требуется ли заново выбрать таблицу и текущий индекс
+
+  /**
+   * @brief Построить таблицу режимов дисплея.
+   */
+  DisplayTable BuildTable(int display_index) {
+    DisplayTable result;
+    auto num_modes = SDL_GetNumDisplayModes(display_index);
+
+    for (auto i = 0; i < num_modes; i++) {
+      SDL_DisplayMode mode;
+
+      if (SDL_GetDisplayMode(display_index, i, &mode)) {
+        continue;
+      }
+
+      // Режимы, различающиеся только форматом пикселей, для игры одинаковы.
+      auto is_duplicate = std::any_of(result.resolutions.begin(), result.resolutions.end(), [&mode](const auto& r) {
+        return r.width == static_cast<size_t>(mode.w) && r.height == static_cast<size_t>(mode.h) && r.refresh_rate == static_cast<size_t>(mode.refresh_rate);
+      });
+      if (is_duplicate) {
+        continue;
+      }
+
+      auto& resolution = result.resolutions.emplace_back();
+      resolution.width = mode.w;
+      resolution.height = mode.h;
+      resolution.refresh_rate = mode.refresh_rate;
+      result.labels.push_back(fmt::format("{}x{} {}hz", resolution.width, resolution.height, resolution.refresh_rate));
+    }
+
+    Logger::Info("Получено {} режимов дисплея {}.", result.resolutions.size(), display_index);
+    return result;
+  }
+
+  /**
+   * @brief Выбрать таблицу дисплея окна и найти в ней текущее разрешение, если что-то изменилось.
+   */
+  void Refresh() {
+    if (!stale) {
+      return;
+    }
+    stale = false;
+
+    const auto* previous_table = table;
+    auto previous_index = active_index;
+
+    auto display_index = SDL_GetWindowDisplayIndex(Game::GetWindow());
+    if (display_index < 0) {
+      table = &empty_table;
+    } else {
+      auto it = tables.find(display_index);
+      if (it == tables.end()) {
+        it = tables.emplace(display_index, BuildTable(display_index)).first;
+        previous_table = nullptr;
+      }
+      table = &it->second;
+    }
+
+    const auto& resolutions = table->resolutions;
+    auto it = std::find_if(resolutions.begin(), resolutions.end(), [](const auto& r) {
+      return r.width == resolution.width && r.height == resolution.height && r.refresh_rate == resolution.refresh_rate;
+    });
+    active_index = it != resolutions.end() ? static_cast<int>(it - resolutions.begin()) : -1;
+
+    // Перемещение окна в пределах дисплея ничего не меняет, и выбор в интерфейсе не сбрасывается.
+    if (table != previous_table || active_index != previous_index) {
+      revision++;
+    }
+  }
+
+  /**
+   * @brief Применить разрешение и режим к окну.
+   */
+  void Apply(const Resolution& requested_resolution, DisplayMode mode) {
+    auto* window = Game::GetWindow();
+    auto display_index = SDL_GetWindowDisplayIndex(window);
+
+    SDL_DisplayMode requested_mode;
+    requested_mode.format = 0;
+    requested_mode.w = requested_resolution.width;
+    requested_mode.h = requested_resolution.height;
+    requested_mode.refresh_rate = requested_resolution.refresh_rate;
+    requested_mode.driverdata = nullptr;
+
+    SDL_DisplayMode final_mode;
+
+    if (!SDL_GetClosestDisplayMode(display_index, &requested_mode, &final_mode)) {
+      Logger::Error(
+        "Не удалось найти ближайшее разрешение под [W:{} H:{} Hz:{} M:{}]...",
+        requested_resolution.width, requested_resolution.height, requested_resolution.refresh_rate, static_cast<int>(mode)
+      );
+      return;
+    }
+
+    switch (mode) {
+      case DisplayMode::Fullscreen:
+        {     
+          SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN);
+          SDL_SetWindowBordered(window, SDL_TRUE);
+          SDL_SetWindowDisplayMode(window, &final_mode);   
+        }
+        break;
+      case DisplayMode::Borderless:
+        {
+          SDL_SetWindowFullscreen(window, 0);
+          SDL_SetWindowBordered(window, SDL_FALSE);
+          SDL_SetWindowSize(window, final_mode.w, final_mode.h);
+        }
+        break;
+      case DisplayMode::Windowed:
+      default:
+        {
+          SDL_SetWindowFullscreen(window, 0);
+          SDL_SetWindowBordered(window, SDL_TRUE);
+          SDL_SetWindowSize(window, final_mode.w, final_mode.h);
+        }
+        break;
+    }
+
+    resolution.width = final_mode.w;
+    resolution.height = final_mode.h;
+    resolution.refresh_rate = final_mode.refresh_rate;
+    display_mode = mode;
+    stale = true;
+
+    Logger::Info(
+      "Разрешение экрана изменено на [W:{} H:{} Hz:{} M:{}].",
+      resolution.width, resolution.height, resolution.refresh_rate, static_cast<int>(mode)
+    );
+  }
 
 } // namespace
 
@@ -19,80 +180,67 @@ const Resolution& GetResolution() {
   return resolution;
 }
 
+DisplayMode GetDisplayMode() {
+  return display_mode;
+}
+
 void SetResolution(const Resolution& requested_resolution, DisplayMode mode) {
-  auto* window = Game::GetWindow();
-  auto display_index = SDL_GetWindowDisplayIndex(window);
-
-  SDL_DisplayMode requested_mode;
-  requested_mode.format = 0;
-  requested_mode.w = requested_resolution.width;
-  requested_mode.h = requested_resolution.height;
-  requested_mode.refresh_rate = requested_resolution.refresh_rate;
-  requested_mode.driverdata = nullptr;
-
-  SDL_DisplayMode final_mode;
-
-  if (!SDL_GetClosestDisplayMode(display_index, &requested_mode, &final_mode)) {
-    Logger::Error(
-      "Не удалось найти ближайшее разрешение под [W:{} H:{} Hz:{} M:{}]...",
-      requested_resolution.width, requested_resolution.height, requested_resolution.refresh_rate, static_cast<int>(mode)
-    );
-    return;
-  }
+  pending = Request{requested_resolution, mode};
+}
 
-  switch (mode) {
-    case DisplayMode::Fullscreen:
-      {     
-        SDL_SetWindowFullscreen(window, SDL_WINDOW_FULLSCREEN);
-        SDL_SetWindowBordered(window, SDL_TRUE);
-        SDL_SetWindowDisplayMode(window, &final_mode);   
-      }
-      break;
-    case DisplayMode::Borderless:
-      {
-        SDL_SetWindowFullscreen(window, 0);
-        SDL_SetWindowBordered(window, SDL_FALSE);
-        SDL_SetWindowSize(window, final_mode.w, final_mode.h);
-      }
-      break;
-    case DisplayMode::Windowed:
-    default:
-      {
-        SDL_SetWindowFullscreen(window, 0);
-        SDL_SetWindowBordered(window, SDL_TRUE);
-        SDL_SetWindowSize(window, final_mode.w, final_mode.h);
-      }
-      break;
-  }
+void Subscribe(EventBus& bus) {
+  // Подключение, отключение и поворот меняют списки режимов, а индексы дисплеев могут сдвинуться.
+  bus.Listen<Events::DisplaysChanged>([](std::span<const Events::DisplaysChanged>) {
+    tables.clear();
+    table = &empty_table;
+    stale = true;
+  });
+
+  bus.Listen<Events::WindowMoved>([](std::span<const Events::WindowMoved>) {
+    stale = true;
+  });
+
+  bus.Listen<Events::WindowDisplayChanged>([](std::span<const Events::WindowDisplayChanged>) {
+    stale = true;
+  });
+
+  // Из пачки важен только последний размер.
+  bus.Listen<Events::WindowResized>([](std::span<const Events::WindowResized> events) {
+    resolution.width = events.back().width;
+    resolution.height = events.back().height;
+    stale = true;
+  });
+}
 
-  resolution.width = final_mode.w;
-  resolution.height = final_mode.h;
-  resolution.refresh_rate = final_mode.refresh_rate;
+bool Update() {
+  if (!pending) {
+    return false;
+  }
 
-  Logger::Info(
-    "Разрешение экрана изменено на [W:{} H:{} Hz:{} M:{}].",
-    resolution.width, resolution.height, resolution.refresh_rate, static_cast<int>(mode)
-  );
+  auto request = *pending;
+  pending.reset();
+  Apply(request.resolution, request.mode);
+  return true;
 }
 
 const std::vector<Resolution>& GetAvailableResolutions() {
-  if (available_resolutions.empty()) {
-    auto display_index = SDL_GetWindowDisplayIndex(Game::GetWindow());
-    auto num_modes = SDL_GetNumDisplayModes(display_index);
-    
-    for (auto i = size_t{0}; i < num_modes; i++) {
-      SDL_DisplayMode mode;
+  Refresh();
+  return table->resolutions;
+}
 
-      if (!SDL_GetDisplayMode(display_index, i, &mode)) {
-        auto& resolution = available_resolutions.emplace_back();
-        resolution.width = mode.w;
-        resolution.height = mode.h;
-        resolution.refresh_rate = mode.refresh_rate;
-      }
-    }
-  }
-  
-  return available_resolutions;
+const std::vector<std::string>& GetResolutionLabels() {
+  Refresh();
+  return table->labels;
+}
+
+int GetActiveResolutionIndex() {
+  Refresh();
+  return active_index;
+}
+
+uint32_t GetRevision() {
+  Refresh();
+  return revision;
 }
 
 } // namespace gb::Screen
@@ -1,11 +1,22 @@
 #ifndef GUIDING_BREEZE_SRC_CORE_SCREEN_H
 #define GUIDING_BREEZE_SRC_CORE_SCREEN_H
 
+#include "core/events/event_bus.hpp"
+
 #include <glm/ext/vector_int2.hpp>
 #include <sys/types.h>
 
+#include <cstdint>
+#include <string>
 #include <vector>
 
+/**
+ * @brief Разрешение и режим отображения окна игры.
+ *
+ * Таблица режимов дисплея, на котором находится окно, строится при первом обращении и
+ * перестраивается только по событиям игры: подключение, отключение или поворот дисплея и
+ * переход окна на другой дисплей. Запрошенная смена режима применяется между кадрами в Update.
+ */
 namespace gb::Screen {
 
 /**
@@ -34,12 +45,18 @@ enum class DisplayMode : u_short {
  */
 const Resolution& GetResolution();
 
+/**
+ * @brief Получить текущий режим отображения.
+ */
+DisplayMode GetDisplayMode();
+
 /**
  * @brief Изменяет разрешение экрана.
  * 
  * @param requested_resolution Запрашиваемое разрешение экрана.
  * @param mode Режим отображения.
  * @note Если соответствующее разрешение не поддерживается, используется ближайшее.
+ * @note Изменение применяется между кадрами в Update; из нескольких запросов за кадр применяется последний.
  */
 void SetResolution(const Resolution& requested_resolution, DisplayMode mode);
 
@@ -61,13 +78,48 @@ inline void SetResolution(size_t width, size_t height, size_t refresh_rate, Disp
   return SetResolution(resolution, mode);
 }
 
+/**
+ * @brief Подписаться на события окна и дисплеев: таблица режимов отмечается устаревшей,
+ * если изменились дисплеи или окно перешло на другой дисплей.
+ */
+void Subscribe(EventBus& bus);
+
+/**
+ * @brief Применить запрошенное изменение разрешения.
+ *
+ * @return true Если режим экрана изменился; кадр при этом мог занять заметно больше времени.
+ * @note Вызывается между кадрами из главного потока.
+ */
+bool Update();
+
 /**
  * @brief Получить информацию обо всех доступных разрешениях экрана.
  * 
- * @return const std::vector<Resolution>& Вектор доступных разрешений.
+ * @return const std::vector<Resolution>& Вектор доступных разрешений дисплея, на котором находится окно.
  */
 const std::vector<Resolution>& GetAvailableResolutions();
 
-}
+/**
+ * @brief Получить подписи доступных разрешений вида "1920x1080 60hz".
+ *
+ * @return const std::vector<std::string>& Подписи в порядке GetAvailableResolutions.
+ */
+const std::vector<std::string>& GetResolutionLabels();
+
+/**
+ * @brief Получить индекс текущего разрешения в GetAvailableResolutions.
+ *
+ * @return int Индекс или -1, если размер окна не совпадает ни с одним режимом дисплея.
+ */
+int GetActiveResolutionIndex();
+
+/**
+ * @brief Получить номер ревизии таблицы режимов.
+ *
+ * @return uint32_t Номер; увеличивается при каждом изменении доступных разрешений или текущего режима.
+ */
+uint32_t GetRevision();
+
+} // namespace gb::Screen
 
 #endif // GUIDING_BREEZE_SRC_CORE_SCREEN_H
\ No newline at end of file
@@ -0,0 +1,282 @@
+#include "archive.hpp"
+
+#include "core/snapshot/lz.hpp"
+#include "logger/logger.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace gb::Snapshot {
+
+OutputArchive::~OutputArchive() noexcept {
+  if (file_) {
+    std::fclose(file_);
+  }
+}
+
+bool OutputArchive::Open(const std::string& path, Compression compression, uint32_t section_count) {
+  file_ = std::fopen(path.c_str(), "wb");
+  if (!file_) {
+    Logger::Error("Не удалось создать файл снимка \"{}\".", path);
+    return false;
+  }
+
+  compression_ = compression;
+  failed_ = false;
+  bytes_written_ = 0;
+
+  const uint32_t header[] = {kMagic, kVersion, static_cast<uint32_t>(compression), section_count};
+  Write(header, sizeof(header));
+  return !failed_;
+}
+
+void OutputArchive::BeginSection(entt::id_type type_id, uint32_t element_size) {
+  if (written_rows_ != section_rows_) {
+    throw std::logic_error("Предыдущая секция снимка записана не полностью");
+  }
+
+  type_id_ = type_id;
+  entity_section_ = type_id == entt::type_hash<entt::entity>::value();
+  element_size_ = element_size;
+  section_rows_ = 0;
+  written_rows_ = 0;
+  expect_ = Expect::Count;
+}
+
+bool OutputArchive::Close() {
+  if (!file_) {
+    return false;
+  }
+
+  if (std::fclose(file_) != 0) {
+    failed_ = true;
+  }
+  file_ = nullptr;
+
+  return !failed_;
+}
+
+size_t OutputArchive::GetBytesWritten() const {
+  return bytes_written_;
+}
+
+void OutputArchive::operator()(EntityType value) {
+  switch (expect_) {
+    case Expect::Count:
+      section_rows_ = value;
+      if (entity_section_) {
+        expect_ = Expect::FreeList;
+      } else {
+        WriteSectionHeader(0);
+        expect_ = Expect::Rows;
+      }
+      break;
+    case Expect::FreeList:
+      WriteSectionHeader(value);
+      expect_ = Expect::Rows;
+      break;
+    case Expect::Rows:
+      throw std::logic_error("Неожиданное значение в строках секции снимка");
+  }
+}
+
+void OutputArchive::operator()(entt::entity entity) {
+  const auto* bytes = reinterpret_cast<const std::byte*>(&entity);
+  entities_.insert(entities_.end(), bytes, bytes + sizeof(entity));
+
+  // В секции сущностей и секциях пустых компонентов строка состоит из одной сущности.
+  if (element_size_ == 0) {
+    FinishRow();
+  }
+}
+
+void OutputArchive::WriteComponent(const void* data, size_t size) {
+  const auto* bytes = static_cast<const std::byte*>(data);
+  components_.insert(components_.end(), bytes, bytes + size);
+  FinishRow();
+}
+
+void OutputArchive::WriteSectionHeader(uint32_t free_list) {
+  const uint32_t header[] = {type_id_, element_size_, section_rows_, free_list};
+  Write(header, sizeof(header));
+}
+
+void OutputArchive::FinishRow() {
+  written_rows_++;
+
+  if (entities_.size() == kChunkRows * sizeof(EntityType) || written_rows_ == section_rows_) {
+    FlushChunk();
+  }
+}
+
+void OutputArchive::FlushChunk() {
+  auto rows = static_cast<uint32_t>(entities_.size() / sizeof(EntityType));
+  if (rows == 0) {
+    return;
+  }
+
+  // Столбцы идут друг за другом: однотипные значения рядом сжимаются заметно лучше строк.
+  auto& payload = entities_;
+  payload.insert(payload.end(), components_.begin(), components_.end());
+  auto raw_size = static_cast<uint32_t>(payload.size());
+
+  const auto* stored = payload.data();
+  auto stored_size = raw_size;
+
+  if (compression_ == Compression::Lz) {
+    compressed_.clear();
+    Compress(payload.data(), payload.size(), compressed_);
+
+    // Несжимаемый фрагмент хранится как есть; равенство размеров означает отсутствие сжатия.
+    if (compressed_.size() < raw_size) {
+      stored = compressed_.data();
+      stored_size = static_cast<uint32_t>(compressed_.size());
+    }
+  }
+
+  const uint32_t header[] = {rows, raw_size, stored_size};
+  Write(header, sizeof(header));
+  Write(stored, stored_size);
+
+  entities_.clear();
+  components_.clear();
+}
+
+void OutputArchive::Write(const void* data, size_t size) {
+  if (failed_ || !file_) {
+    failed_ = true;
+    return;
+  }
+
+  if (std::fwrite(data, 1, size, file_) != size) {
+    failed_ = true;
+    return;
+  }
+
+  bytes_written_ += size;
+}
+
+bool InputArchive::Open(const std::string& path, uint32_t section_count) {
+  if (!file_.Open(path)) {
+    Logger::Error("Не удалось открыть файл снимка \"{}\".", path);
+    return false;
+  }
+
+  uint32_t header[4];
+  if (file_.GetSize() < sizeof(header)) {
+    Logger::Error("Файл \"{}\" не является снимком.", path);
+    return false;
+  }
+
+  std::memcpy(header, file_.GetData(), sizeof(header));
+  offset_ = sizeof(header);
+
+  if (header[0] != kMagic) {
+    Logger::Error("Файл \"{}\" не является снимком.", path);
+    return false;
+  }
+
+  if (header[1] != kVersion) {
+    Logger::Error("Версия снимка \"{}\" ({}) не поддерживается, ожидается {}.", path, header[1], kVersion);
+    return false;
+  }
+
+  if (header[3] != section_count) {
+    Logger::Error("Набор компонентов снимка \"{}\" не совпадает с текущим.", path);
+    return false;
+  }
+
+  return true;
+}
+
+void InputArchive::BeginSection(entt::id_type type_id, uint32_t element_size) {
+  uint32_t header[4];
+  Read(header, sizeof(header));
+
+  if (header[0] != type_id || header[1] != element_size) {
+    throw std::runtime_error("секция не совпадает с ожидаемым компонентом");
+  }
+
+  entity_section_ = type_id == entt::type_hash<entt::entity>::value();
+  element_size_ = element_size;
+  section_rows_ = header[2];
+  free_list_ = header[3];
+  expect_ = Expect::Count;
+  chunk_rows_ = 0;
+  entity_cursor_ = 0;
+  component_cursor_ = 0;
+}
+
+void InputArchive::operator()(EntityType& value) {
+  switch (expect_) {
+    case Expect::Count:
+      value = section_rows_;
+      expect_ = entity_section_ ? Expect::FreeList : Expect::Rows;
+      break;
+    case Expect::FreeList:
+      value = free_list_;
+      expect_ = Expect::Rows;
+      break;
+    case Expect::Rows:
+      throw std::runtime_error("неожиданное значение в строках секции");
+  }
+}
+
+void InputArchive::operator()(entt::entity& entity) {
+  if (entity_cursor_ == chunk_rows_) {
+    LoadChunk();
+  }
+
+  std::memcpy(&entity, entity_column_ + static_cast<size_t>(entity_cursor_) * sizeof(entity), sizeof(entity));
+  entity_cursor_++;
+}
+
+void InputArchive::ReadComponent(void* data, size_t size) {
+  if (size != element_size_ || component_cursor_ >= entity_cursor_) {
+    throw std::runtime_error("компонент не соответствует строке секции");
+  }
+
+  std::memcpy(data, component_column_ + static_cast<size_t>(component_cursor_) * size, size);
+  component_cursor_++;
+}
+
+void InputArchive::LoadChunk() {
+  uint32_t header[3];
+  Read(header, sizeof(header));
+
+  auto rows = header[0];
+  auto raw_size = header[1];
+  auto stored_size = header[2];
+
+  if (rows == 0 || rows > kChunkRows || raw_size != rows * (sizeof(EntityType) + element_size_)
+      || stored_size > raw_size || stored_size > file_.GetSize() - offset_) {
+    throw std::runtime_error("некорректный заголовок фрагмента");
+  }
+
+  const auto* payload = file_.GetData() + offset_;
+  if (stored_size < raw_size) {
+    buffer_.resize(raw_size);
+    if (!Decompress(payload, stored_size, buffer_.data(), raw_size)) {
+      throw std::runtime_error("не удалось распаковать фрагмент");
+    }
+    payload = buffer_.data();
+  }
+  offset_ += stored_size;
+
+  entity_column_ = payload;
+  component_column_ = payload + static_cast<size_t>(rows) * sizeof(EntityType);
+  chunk_rows_ = rows;
+  entity_cursor_ = 0;
+  component_cursor_ = 0;
+}
+
+void InputArchive::Read(void* data, size_t size) {
+  if (size > file_.GetSize() - offset_) {
+    throw std::runtime_error("файл обрывается");
+  }
+
+  std::memcpy(data, file_.GetData() + offset_, size);
+  offset_ += size;
+}
+
+} // namespace gb::Snapshot
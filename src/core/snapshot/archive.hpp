@@ -0,0 +1,235 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SNAPSHOT_ARCHIVE_H
+#define GUIDING_BREEZE_SRC_CORE_SNAPSHOT_ARCHIVE_H
+
+#include "core/snapshot/mapped_file.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <sys/types.h>
+#include <type_traits>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace gb::Snapshot {
+
+/**
+ * @brief Формат файла снимка.
+ *
+ * Все поля заголовков - uint32_t в порядке байтов платформы; файл с чужим порядком байтов
+ * не проходит проверку сигнатуры.
+ *
+ * Файл: {сигнатура, версия, сжатие, количество секций}, затем секции - сначала сущности,
+ * затем компоненты в порядке записи.
+ * Секция: {тип, размер компонента, количество строк, количество используемых сущностей},
+ * затем фрагменты по kChunkRows строк. У пустых компонентов-меток размер 0: их строки состоят
+ * только из сущностей.
+ * Фрагмент: {строк, размер данных, размер хранимых данных}, затем данные по столбцам -
+ * идентификаторы сущностей всех строк, затем компоненты всех строк. Данные хранятся
+ * сжатыми, только если сжатие уменьшило их размер.
+ */
+constexpr uint32_t kMagic = 0x53534247; //< Сигнатура "GBSS"
+constexpr uint32_t kVersion = 1;        //< Версия формата; файлы другой версии не читаются
+constexpr uint32_t kChunkRows = 16384;  //< Количество строк во фрагменте
+
+/**
+ * @brief Размер компонента в строке секции; EnTT не хранит значения пустых компонентов.
+ */
+template<typename Component>
+inline constexpr uint32_t kElementSize = std::is_empty_v<Component> ? 0 : sizeof(Component);
+
+/**
+ * @brief Сжатие фрагментов снимка.
+ */
+enum class Compression : u_short {
+  None, //< Без сжатия; чтение не копирует данные из отображенного файла
+  Lz    //< Сжатие LZ; файл меньше, чтение распаковывает каждый фрагмент
+};
+
+/**
+ * @brief Подготовка копии компонента к записи в снимок.
+ *
+ * Специализируется для компонентов с полями, не имеющими смысла вне текущего запуска,
+ * например указателями на ресурсы.
+ */
+template<typename Component>
+struct SaveTraits {
+  static void Prepare(Component&) {}
+};
+
+/**
+ * @brief Архив записи для entt::snapshot, пишущий секции снимка в файл по фрагментам.
+ */
+class OutputArchive final {
+private:
+  using EntityType = entt::entt_traits<entt::entity>::entity_type;
+
+  enum class Expect : u_short {
+    Count,    //< Ожидается количество строк секции
+    FreeList, //< Ожидается количество используемых сущностей (только в секции сущностей)
+    Rows      //< Ожидаются строки
+  };
+
+private:
+  std::FILE* file_{nullptr};                   //< Файл снимка
+  Compression compression_{Compression::None}; //< Сжатие фрагментов
+  bool failed_{false};                         //< Была ли ошибка записи
+  size_t bytes_written_{0};                    //< Количество записанных байтов
+  entt::id_type type_id_{0};                   //< Тип текущей секции
+  bool entity_section_{false};                 //< Записывается ли секция сущностей
+  uint32_t element_size_{0};                   //< Размер компонента текущей секции; 0 для сущностей и пустых компонентов
+  uint32_t section_rows_{0};                   //< Количество строк текущей секции
+  uint32_t written_rows_{0};                   //< Количество записанных строк текущей секции
+  Expect expect_{Expect::Count};               //< Ожидаемое архивом значение
+  std::vector<std::byte> entities_;            //< Столбец сущностей текущего фрагмента
+  std::vector<std::byte> components_;          //< Столбец компонентов текущего фрагмента
+  std::vector<std::byte> compressed_;          //< Буфер сжатого фрагмента
+
+public:
+  OutputArchive() = default;
+  OutputArchive(const OutputArchive&) = delete;
+  OutputArchive(OutputArchive&&) = delete;
+  ~OutputArchive() noexcept;
+
+public:
+  OutputArchive& operator=(const OutputArchive&) = delete;
+  OutputArchive& operator=(OutputArchive&&) = delete;
+
+public:
+  /**
+   * @brief Создать файл и записать заголовок.
+   *
+   * @param path Путь к файлу.
+   * @param compression Сжатие фрагментов.
+   * @param section_count Количество секций, которые будут записаны.
+   * @return true Если файл создан.
+   */
+  bool Open(const std::string& path, Compression compression, uint32_t section_count);
+
+  /**
+   * @brief Начать секцию; следующие вызовы entt::snapshot::get пишут в нее.
+   *
+   * @param type_id Идентификатор типа хранилища.
+   * @param element_size Размер компонента kElementSize; 0 для секции сущностей.
+   */
+  void BeginSection(entt::id_type type_id, uint32_t element_size);
+
+  /**
+   * @brief Закрыть файл.
+   *
+   * @return true Если все данные записаны без ошибок.
+   */
+  bool Close();
+
+  /**
+   * @brief Получить количество записанных байтов.
+   */
+  [[nodiscard]] size_t GetBytesWritten() const;
+
+  void operator()(EntityType value);
+  void operator()(entt::entity entity);
+
+  template<typename Component>
+  void operator()(const Component& component) {
+    static_assert(std::is_trivially_copyable_v<Component>, "Компонент снимка должен быть тривиально копируемым");
+
+    // Строка пустого компонента завершается сущностью, значение не записывается.
+    if constexpr (!std::is_empty_v<Component>) {
+      auto copy = component;
+      SaveTraits<Component>::Prepare(copy);
+      WriteComponent(&copy, sizeof(copy));
+    }
+  }
+
+private:
+  void WriteComponent(const void* data, size_t size);
+  void WriteSectionHeader(uint32_t free_list);
+  void FinishRow();
+  void FlushChunk();
+  void Write(const void* data, size_t size);
+};
+
+/**
+ * @brief Архив чтения для entt::snapshot_loader, читающий снимок из отображенного в память файла.
+ *
+ * Несжатые фрагменты читаются прямо из отображения. При повреждении файла операторы
+ * чтения выбрасывают std::runtime_error, поскольку entt::snapshot_loader не проверяет
+ * результат вызовов архива.
+ */
+class InputArchive final {
+private:
+  using EntityType = entt::entt_traits<entt::entity>::entity_type;
+
+  enum class Expect : u_short {
+    Count,    //< Ожидается количество строк секции
+    FreeList, //< Ожидается количество используемых сущностей (только в секции сущностей)
+    Rows      //< Ожидаются строки
+  };
+
+private:
+  MappedFile file_;                            //< Отображенный файл
+  size_t offset_{0};                           //< Смещение следующего непрочитанного байта
+  bool entity_section_{false};                 //< Читается ли секция сущностей
+  uint32_t element_size_{0};                   //< Размер компонента текущей секции
+  uint32_t section_rows_{0};                   //< Количество строк текущей секции
+  uint32_t free_list_{0};                      //< Количество используемых сущностей
+  Expect expect_{Expect::Count};               //< Ожидаемое значение
+  const std::byte* entity_column_{nullptr};    //< Столбец сущностей текущего фрагмента
+  const std::byte* component_column_{nullptr}; //< Столбец компонентов текущего фрагмента
+  uint32_t chunk_rows_{0};                     //< Количество строк текущего фрагмента
+  uint32_t entity_cursor_{0};                  //< Индекс следующей сущности фрагмента
+  uint32_t component_cursor_{0};               //< Индекс следующего компонента фрагмента
+  std::vector<std::byte> buffer_;              //< Буфер распакованного фрагмента
+
+public:
+  InputArchive() = default;
+  InputArchive(const InputArchive&) = delete;
+  InputArchive(InputArchive&&) = delete;
+  ~InputArchive() noexcept = default;
+
+public:
+  InputArchive& operator=(const InputArchive&) = delete;
+  InputArchive& operator=(InputArchive&&) = delete;
+
+public:
+  /**
+   * @brief Открыть файл и проверить заголовок.
+   *
+   * @param path Путь к файлу.
+   * @param section_count Ожидаемое количество секций.
+   * @return true Если файл открыт, а версия формата и набор секций совпадают.
+   */
+  bool Open(const std::string& path, uint32_t section_count);
+
+  /**
+   * @brief Начать чтение секции.
+   *
+   * @param type_id Ожидаемый идентификатор типа хранилища.
+   * @param element_size Ожидаемый размер компонента kElementSize; 0 для секции сущностей.
+   * @throw std::runtime_error Если секция в файле не совпадает с ожидаемой.
+   */
+  void BeginSection(entt::id_type type_id, uint32_t element_size);
+
+  void operator()(EntityType& value);
+  void operator()(entt::entity& entity);
+
+  template<typename Component>
+  void operator()(Component& component) {
+    static_assert(std::is_trivially_copyable_v<Component>, "Компонент снимка должен быть тривиально копируемым");
+
+    if constexpr (!std::is_empty_v<Component>) {
+      ReadComponent(&component, sizeof(component));
+    }
+  }
+
+private:
+  void ReadComponent(void* data, size_t size);
+  void LoadChunk();
+  void Read(void* data, size_t size);
+};
+
+} // namespace gb::Snapshot
+
+#endif // GUIDING_BREEZE_SRC_CORE_SNAPSHOT_ARCHIVE_H
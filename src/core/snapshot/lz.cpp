@@ -0,0 +1,176 @@
+#include "lz.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace gb::Snapshot {
+
+namespace {
+
+  constexpr size_t kMinMatch = 4; //< Наименьшая длина совпадения
+  constexpr size_t kLastLiterals = 5; //< Количество последних байтов, всегда записываемых как литералы
+  constexpr size_t kMatchLimit = 12; //< Совпадение не может начинаться ближе этого расстояния до конца блока
+  constexpr size_t kMaxOffset = 65535; //< Наибольшее расстояние до совпадения
+  constexpr unsigned kHashBits = 14; //< Разрядность хэша последовательностей
+  constexpr unsigned kSkipTrigger = 6; //< Ускорение поиска на несжимаемых данных: шаг растет каждые 2^6 промахов
+
+  [[nodiscard]] uint32_t Read32(const std::byte* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+  }
+
+  [[nodiscard]] uint32_t Hash(uint32_t sequence) {
+    return (sequence * 2654435761U) >> (32 - kHashBits);
+  }
+
+  /**
+   * @brief Записать продолжение длины: байты 255, пока остаток не меньше 255.
+   */
+  void WriteLength(std::vector<std::byte>& output, size_t length) {
+    while (length >= 255) {
+      output.push_back(std::byte{255});
+      length -= 255;
+    }
+    output.push_back(static_cast<std::byte>(length));
+  }
+
+  /**
+   * @brief Записать последовательность: литералы и, если match_length не равна нулю, совпадение.
+   */
+  void WriteSequence(
+    std::vector<std::byte>& output, const std::byte* literals, size_t literal_length, size_t offset,
+    size_t match_length
+  ) {
+    auto encoded_match = match_length > 0 ? match_length - kMinMatch : 0;
+    auto token = (std::min<size_t>(literal_length, 15) << 4) | std::min<size_t>(encoded_match, 15);
+    output.push_back(static_cast<std::byte>(token));
+
+    if (literal_length >= 15) {
+      WriteLength(output, literal_length - 15);
+    }
+    output.insert(output.end(), literals, literals + literal_length);
+
+    if (match_length == 0) {
+      return;
+    }
+
+    output.push_back(static_cast<std::byte>(offset & 0xFF));
+    output.push_back(static_cast<std::byte>(offset >> 8));
+    if (encoded_match >= 15) {
+      WriteLength(output, encoded_match - 15);
+    }
+  }
+
+  /**
+   * @brief Прочитать продолжение длины.
+   *
+   * @return true Если данные не закончились раньше времени.
+   */
+  [[nodiscard]] bool ReadLength(const std::byte*& input, const std::byte* end, size_t& length) {
+    while (true) {
+      if (input == end) {
+        return false;
+      }
+
+      auto value = static_cast<size_t>(*input++);
+      length += value;
+      if (value != 255) {
+        return true;
+      }
+    }
+  }
+
+} // namespace
+
+void Compress(const std::byte* data, size_t size, std::vector<std::byte>& output) {
+  std::array<uint32_t, size_t{1} << kHashBits> table{};
+
+  auto anchor = size_t{0};
+  auto position = size_t{0};
+  auto misses = size_t{0};
+
+  if (size > kMatchLimit) {
+    auto limit = size - kMatchLimit;
+
+    while (position < limit) {
+      auto sequence = Read32(data + position);
+      auto& slot = table[Hash(sequence)];
+      auto candidate = static_cast<size_t>(slot);
+      slot = static_cast<uint32_t>(position);
+
+      if (candidate >= position || position - candidate > kMaxOffset || Read32(data + candidate) != sequence) {
+        position += 1 + (misses++ >> kSkipTrigger);
+        continue;
+      }
+      misses = 0;
+
+      auto match_length = kMinMatch;
+      while (position + match_length < size - kLastLiterals && data[candidate + match_length] == data[position + match_length]) {
+        match_length++;
+      }
+
+      WriteSequence(output, data + anchor, position - anchor, position - candidate, match_length);
+      position += match_length;
+      anchor = position;
+    }
+  }
+
+  WriteSequence(output, data + anchor, size - anchor, 0, 0);
+}
+
+bool Decompress(const std::byte* data, size_t size, std::byte* output, size_t output_size) {
+  const auto* input = data;
+  const auto* input_end = data + size;
+  auto written = size_t{0};
+
+  while (input < input_end) {
+    auto token = static_cast<size_t>(*input++);
+
+    auto literal_length = token >> 4;
+    if (literal_length == 15 && !ReadLength(input, input_end, literal_length)) {
+      return false;
+    }
+    if (literal_length > static_cast<size_t>(input_end - input) || literal_length > output_size - written) {
+      return false;
+    }
+
+    std::memcpy(output + written, input, literal_length);
+    input += literal_length;
+    written += literal_length;
+
+    // Последняя последовательность состоит только из литералов.
+    if (input == input_end) {
+      break;
+    }
+
+    if (input_end - input < 2) {
+      return false;
+    }
+    auto offset = static_cast<size_t>(input[0]) | (static_cast<size_t>(input[1]) << 8);
+    input += 2;
+
+    auto match_length = token & 0x0F;
+    if (match_length == 15 && !ReadLength(input, input_end, match_length)) {
+      return false;
+    }
+    match_length += kMinMatch;
+
+    if (offset == 0 || offset > written || match_length > output_size - written) {
+      return false;
+    }
+
+    // Совпадение может перекрывать само себя, поэтому копируется побайтно.
+    const auto* source = output + written - offset;
+    for (auto i = size_t{0}; i < match_length; i++) {
+      output[written + i] = source[i];
+    }
+    written += match_length;
+  }
+
+  return written == output_size;
+}
+
+} // namespace gb::Snapshot
@@ -0,0 +1,34 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SNAPSHOT_LZ_H
+#define GUIDING_BREEZE_SRC_CORE_SNAPSHOT_LZ_H
+
+#include <cstddef>
+#include <vector>
+
+namespace gb::Snapshot {
+
+/**
+ * @brief Сжать блок данных алгоритмом семейства LZ77 в формате блоков LZ4.
+ *
+ * Совпадения ищутся по хэшу 4-байтовых последовательностей в окне 64 КБ; для
+ * столбцов одинаковых чисел, из которых состоят снимки, этого достаточно.
+ *
+ * @param data Исходные данные.
+ * @param size Размер исходных данных в байтах.
+ * @param output Буфер, в конец которого дописываются сжатые данные.
+ */
+void Compress(const std::byte* data, size_t size, std::vector<std::byte>& output);
+
+/**
+ * @brief Распаковать блок, сжатый функцией Compress.
+ *
+ * @param data Сжатые данные.
+ * @param size Размер сжатых данных в байтах.
+ * @param output Буфер для распакованных данных.
+ * @param output_size Ожидаемый размер распакованных данных в байтах.
+ * @return true Если блок корректен и распакован ровно в output_size байт.
+ */
+[[nodiscard]] bool Decompress(const std::byte* data, size_t size, std::byte* output, size_t output_size);
+
+} // namespace gb::Snapshot
+
+#endif // GUIDING_BREEZE_SRC_CORE_SNAPSHOT_LZ_H
@@ -0,0 +1,165 @@
+#include "mapped_file.hpp"
+
+#include <fstream>
+#include <utility>
+
+#if defined(_WIN32)
+  #define WIN32_LEAN_AND_MEAN
+  #define NOMINMAX
+  #include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace gb {
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+  : data_(std::exchange(other.data_, nullptr)),
+    size_(std::exchange(other.size_, 0)),
+    buffer_(std::move(other.buffer_)) {}
+
+MappedFile::~MappedFile() noexcept {
+  Close();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    Close();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+bool MappedFile::Open(const std::string& path) {
+  Close();
+
+  // Файл, который не удалось отобразить (например, на сетевой или виртуальной файловой системе),
+  // читается в буфер.
+  return Map(path) || Read(path);
+}
+
+void MappedFile::Close() {
+  if (data_ && buffer_.empty()) {
+#if defined(_WIN32)
+    UnmapViewOfFile(data_);
+#elif defined(__unix__) || defined(__APPLE__)
+    munmap(const_cast<std::byte*>(data_), size_);
+#endif
+  }
+  data_ = nullptr;
+  size_ = 0;
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+}
+
+const std::byte* MappedFile::GetData() const {
+  return data_;
+}
+
+size_t MappedFile::GetSize() const {
+  return size_;
+}
+
+bool MappedFile::Map(const std::string& path) {
+#if defined(_WIN32)
+  auto file = CreateFileA(
+    path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+  );
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+
+  LARGE_INTEGER file_size{};
+  if (!GetFileSizeEx(file, &file_size)) {
+    CloseHandle(file);
+    return false;
+  }
+
+  // Отображение пустого файла не создается
+  size_ = static_cast<size_t>(file_size.QuadPart);
+  if (size_ == 0) {
+    CloseHandle(file);
+    return true;
+  }
+
+  auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  auto* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+  // Представление остается действительным и после закрытия дескрипторов.
+  if (mapping) {
+    CloseHandle(mapping);
+  }
+  CloseHandle(file);
+
+  if (!view) {
+    size_ = 0;
+    return false;
+  }
+
+  data_ = static_cast<const std::byte*>(view);
+  return true;
+#elif defined(__unix__) || defined(__APPLE__)
+  auto descriptor = open(path.c_str(), O_RDONLY);
+  if (descriptor < 0) {
+    return false;
+  }
+
+  struct stat status{};
+  if (fstat(descriptor, &status) != 0) {
+    close(descriptor);
+    return false;
+  }
+
+  size_ = static_cast<size_t>(status.st_size);
+  if (size_ == 0) {
+    close(descriptor);
+    return true;
+  }
+
+  auto* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  // Отображение остается действительным и после закрытия дескриптора.
+  close(descriptor);
+
+  if (mapping == MAP_FAILED) {
+    size_ = 0;
+    return false;
+  }
+
+  // Снимок читается от начала до конца, поэтому системе выгодно читать страницы с опережением.
+  madvise(mapping, size_, MADV_SEQUENTIAL);
+  data_ = static_cast<const std::byte*>(mapping);
+  return true;
+#else
+  static_cast<void>(path);
+  return false;
+#endif
+}
+
+bool MappedFile::Read(const std::string& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+
+  auto file_size = static_cast<size_t>(file.tellg());
+  if (file_size == 0) {
+    return true;
+  }
+
+  buffer_.resize(file_size);
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(file_size))) {
+    buffer_.clear();
+    return false;
+  }
+
+  data_ = buffer_.data();
+  size_ = file_size;
+  return true;
+}
+
+} // namespace gb
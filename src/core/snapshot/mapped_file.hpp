@@ -0,0 +1,65 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SNAPSHOT_MAPPED_FILE_H
+#define GUIDING_BREEZE_SRC_CORE_SNAPSHOT_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace gb {
+
+/**
+ * @brief Файл, отображенный в память только для чтения.
+ *
+ * Страницы файла подгружаются системой по мере обращения, поэтому данные читаются
+ * без промежуточных буферов и копирования. Отображение выполняется через mmap на UNIX-системах
+ * и CreateFileMapping в Windows; на остальных системах и при ошибке отображения файл целиком
+ * читается в буфер.
+ */
+class MappedFile final {
+private:
+  const std::byte* data_{nullptr}; //< Начало отображения или буфера
+  size_t size_{0};                 //< Размер файла в байтах
+  std::vector<std::byte> buffer_;  //< Содержимое файла, если он прочитан, а не отображен
+
+public:
+  MappedFile() = default;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  ~MappedFile() noexcept;
+
+public:
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+public:
+  /**
+   * @brief Отобразить файл в память.
+   *
+   * @param path Путь к файлу.
+   * @return true Если файл отображен; пустой файл отображается как пустой диапазон.
+   */
+  bool Open(const std::string& path);
+
+  /**
+   * @brief Снять отображение.
+   */
+  void Close();
+
+  /**
+   * @brief Получить указатель на начало данных файла.
+   */
+  [[nodiscard]] const std::byte* GetData() const;
+
+  /**
+   * @brief Получить размер файла в байтах.
+   */
+  [[nodiscard]] size_t GetSize() const;
+
+private:
+  bool Map(const std::string& path);
+  bool Read(const std::string& path);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_SNAPSHOT_MAPPED_FILE_H
@@ -0,0 +1,88 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SNAPSHOT_SNAPSHOT_H
+#define GUIDING_BREEZE_SRC_CORE_SNAPSHOT_SNAPSHOT_H
+
+#include "core/snapshot/archive.hpp"
+#include "logger/logger.hpp"
+#include "profiler/profiler.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "entt/entt.hpp"
+
+namespace gb::Snapshot {
+
+/**
+ * @brief Сохранить сущности реестра и заданные компоненты в файл.
+ *
+ * @tparam Components Сохраняемые компоненты; тривиально копируемые, порядок должен совпадать с Load.
+ * @param registry Реестр сущностей.
+ * @param path Путь к файлу.
+ * @param compression Сжатие фрагментов.
+ * @return true Если снимок записан.
+ */
+template<typename... Components>
+bool Save(const entt::registry& registry, const std::string& path, Compression compression = Compression::Lz) {
+  GB_PROFILE_ZONE("Сохранение снимка");
+
+  OutputArchive archive;
+  if (!archive.Open(path, compression, 1 + sizeof...(Components))) {
+    return false;
+  }
+
+  entt::snapshot snapshot{registry};
+
+  archive.BeginSection(entt::type_hash<entt::entity>::value(), 0);
+  snapshot.get<entt::entity>(archive);
+
+  (..., (archive.BeginSection(entt::type_hash<Components>::value(), kElementSize<Components>), snapshot.get<Components>(archive)));
+
+  if (!archive.Close()) {
+    Logger::Error("Не удалось записать снимок \"{}\".", path);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Заменить содержимое реестра снимком из файла.
+ *
+ * @tparam Components Загружаемые компоненты в том же порядке, что и при сохранении.
+ * @param registry Реестр сущностей; очищается перед загрузкой, подписчики сигналов сохраняются.
+ * @param path Путь к файлу.
+ * @return true Если снимок загружен. Если файл не удалось открыть или его версия и количество
+ * секций не совпадают, реестр не изменяется; при ошибке чтения секций реестр остается пустым.
+ */
+template<typename... Components>
+bool Load(entt::registry& registry, const std::string& path) {
+  GB_PROFILE_ZONE("Загрузка снимка");
+
+  InputArchive archive;
+  if (!archive.Open(path, 1 + sizeof...(Components))) {
+    return false;
+  }
+
+  registry.clear();
+
+  try {
+    entt::snapshot_loader loader{registry};
+
+    archive.BeginSection(entt::type_hash<entt::entity>::value(), 0);
+    loader.get<entt::entity>(archive);
+
+    (..., (archive.BeginSection(entt::type_hash<Components>::value(), kElementSize<Components>), loader.get<Components>(archive)));
+
+    loader.orphans();
+  } catch (const std::runtime_error& error) {
+    Logger::Error("Снимок \"{}\" поврежден: {}.", path, error.what());
+    registry.clear();
+    return false;
+  }
+
+  return true;
+}
+
+} // namespace gb::Snapshot
+
+#endif // GUIDING_BREEZE_SRC_CORE_SNAPSHOT_SNAPSHOT_H
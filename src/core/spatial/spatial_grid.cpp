@@ -0,0 +1,286 @@
+#include "spatial_grid.hpp"
+
+#include "core/components/transform_component.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace gb {
+
+template<typename Func>
+void SpatialGrid::ForEachCell(int32_t min_x, int32_t min_y, int32_t max_x, int32_t max_y, Func&& func) const {
+  min_x = std::max(min_x, min_cell_x_);
+  min_y = std::max(min_y, min_cell_y_);
+  max_x = std::min(max_x, max_cell_x_);
+  max_y = std::min(max_y, max_cell_y_);
+
+  if (min_x > max_x || min_y > max_y) {
+    return;
+  }
+
+  // Если область покрывает больше ячеек, чем занято, дешевле перебрать занятые ячейки.
+  auto area = static_cast<uint64_t>(max_x - min_x + 1) * static_cast<uint64_t>(max_y - min_y + 1);
+  if (area > cells_.size()) {
+    for (const auto& [key, items] : cells_) {
+      auto cell_x = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+      auto cell_y = static_cast<int32_t>(static_cast<uint32_t>(key));
+      if (cell_x >= min_x && cell_x <= max_x && cell_y >= min_y && cell_y <= max_y) {
+        func(items);
+      }
+    }
+    return;
+  }
+
+  for (auto cell_y = min_y; cell_y <= max_y; cell_y++) {
+    for (auto cell_x = min_x; cell_x <= max_x; cell_x++) {
+      if (auto it = cells_.find(ToKey(cell_x, cell_y)); it != cells_.end()) {
+        func(it->second);
+      }
+    }
+  }
+}
+
+SpatialGrid::SpatialGrid(entt::registry* registry, float cell_size)
+  : registry_(registry), cell_size_(cell_size), inverse_cell_size_(1.0F / cell_size) {
+  if (!(cell_size > 0.0F)) {
+    throw std::logic_error("Размер ячейки сетки должен быть положительным");
+  }
+
+  for (auto [entity, transform] : registry_->view<TransformComponent>().each()) {
+    Insert(entity, transform.x, transform.y);
+  }
+
+  registry_->on_construct<TransformComponent>().connect<&SpatialGrid::OnConstruct>(*this);
+  registry_->on_update<TransformComponent>().connect<&SpatialGrid::OnUpdate>(*this);
+  registry_->on_destroy<TransformComponent>().connect<&SpatialGrid::OnDestroy>(*this);
+}
+
+SpatialGrid::~SpatialGrid() noexcept {
+  registry_->on_construct<TransformComponent>().disconnect<&SpatialGrid::OnConstruct>(*this);
+  registry_->on_update<TransformComponent>().disconnect<&SpatialGrid::OnUpdate>(*this);
+  registry_->on_destroy<TransformComponent>().disconnect<&SpatialGrid::OnDestroy>(*this);
+}
+
+std::span<const entt::entity> SpatialGrid::QueryRange(float min_x, float min_y, float max_x, float max_y) {
+  results_.clear();
+
+  ForEachCell(ToCell(min_x), ToCell(min_y), ToCell(max_x), ToCell(max_y), [&](const std::vector<Item>& items) {
+    for (const auto& item : items) {
+      if (item.x >= min_x && item.x <= max_x && item.y >= min_y && item.y <= max_y) {
+        results_.push_back(item.entity);
+      }
+    }
+  });
+
+  return results_;
+}
+
+std::span<const entt::entity> SpatialGrid::QueryRadius(float x, float y, float radius) {
+  results_.clear();
+
+  auto radius_squared = radius * radius;
+  ForEachCell(ToCell(x - radius), ToCell(y - radius), ToCell(x + radius), ToCell(y + radius), [&](const std::vector<Item>& items) {
+    for (const auto& item : items) {
+      auto dx = item.x - x;
+      auto dy = item.y - y;
+      if (dx * dx + dy * dy <= radius_squared) {
+        results_.push_back(item.entity);
+      }
+    }
+  });
+
+  return results_;
+}
+
+std::span<const entt::entity> SpatialGrid::QueryNearest(float x, float y, size_t count) {
+  results_.clear();
+  nearest_.clear();
+
+  if (count == 0 || size_ == 0) {
+    return results_;
+  }
+
+  auto center_x = ToCell(x);
+  auto center_y = ToCell(y);
+
+  // Кольца ячеек просматриваются от центра, пока следующее кольцо может содержать более близкую сущность.
+  // Куча упорядочена так, что в ее вершине находится самый дальний из найденных кандидатов.
+  auto max_ring = std::max(
+    std::max(center_x - min_cell_x_, max_cell_x_ - center_x), std::max(center_y - min_cell_y_, max_cell_y_ - center_y)
+  );
+  // Кольца, не пересекающие занятые ячейки, пропускаются.
+  auto min_ring = std::max(
+    std::max({0, min_cell_x_ - center_x, center_x - max_cell_x_}), std::max(min_cell_y_ - center_y, center_y - max_cell_y_)
+  );
+
+  for (auto ring = min_ring; ring <= max_ring; ring++) {
+    if (nearest_.size() == count) {
+      auto ring_distance = static_cast<float>(ring - 1) * cell_size_;
+      if (ring_distance > 0.0F && ring_distance * ring_distance > nearest_.front().first) {
+        break;
+      }
+    }
+
+    auto visit = [&](int32_t cell_x, int32_t cell_y) {
+      auto it = cells_.find(ToKey(cell_x, cell_y));
+      if (it == cells_.end()) {
+        return;
+      }
+
+      for (const auto& item : it->second) {
+        auto dx = item.x - x;
+        auto dy = item.y - y;
+        auto distance = dx * dx + dy * dy;
+
+        if (nearest_.size() < count) {
+          nearest_.emplace_back(distance, item.entity);
+          std::push_heap(nearest_.begin(), nearest_.end());
+        } else if (distance < nearest_.front().first) {
+          std::pop_heap(nearest_.begin(), nearest_.end());
+          nearest_.back() = {distance, item.entity};
+          std::push_heap(nearest_.begin(), nearest_.end());
+        }
+      }
+    };
+
+    if (ring == 0) {
+      visit(center_x, center_y);
+      continue;
+    }
+
+    for (auto dx = -ring; dx <= ring; dx++) {
+      visit(center_x + dx, center_y - ring);
+      visit(center_x + dx, center_y + ring);
+    }
+    for (auto dy = -ring + 1; dy <= ring - 1; dy++) {
+      visit(center_x - ring, center_y + dy);
+      visit(center_x + ring, center_y + dy);
+    }
+  }
+
+  std::sort_heap(nearest_.begin(), nearest_.end());
+  for (const auto& [distance, entity] : nearest_) {
+    results_.push_back(entity);
+  }
+
+  return results_;
+}
+
+void SpatialGrid::Refresh(entt::entity entity) {
+  if (const auto* transform = registry_->try_get<TransformComponent>(entity)) {
+    Move(entity, transform->x, transform->y);
+  }
+}
+
+size_t SpatialGrid::GetSize() const {
+  return size_;
+}
+
+size_t SpatialGrid::GetCellCount() const {
+  return cells_.size();
+}
+
+float SpatialGrid::GetCellSize() const {
+  return cell_size_;
+}
+
+void SpatialGrid::OnConstruct(entt::registry& registry, entt::entity entity) {
+  const auto& transform = registry.get<TransformComponent>(entity);
+  Insert(entity, transform.x, transform.y);
+}
+
+void SpatialGrid::OnUpdate(entt::registry& registry, entt::entity entity) {
+  const auto& transform = registry.get<TransformComponent>(entity);
+  Move(entity, transform.x, transform.y);
+}
+
+void SpatialGrid::OnDestroy(entt::registry&, entt::entity entity) {
+  Remove(entity);
+}
+
+void SpatialGrid::Insert(entt::entity entity, float x, float y) {
+  auto index = static_cast<size_t>(entt::to_entity(entity));
+  if (index >= slots_.size()) {
+    slots_.resize(index + 1);
+  }
+
+  auto cell_x = ToCell(x);
+  auto cell_y = ToCell(y);
+  auto key = ToKey(cell_x, cell_y);
+  auto& items = cells_[key];
+
+  slots_[index] = Slot{key, static_cast<uint32_t>(items.size())};
+  items.push_back(Item{entity, x, y});
+  size_++;
+
+  if (size_ == 1 && max_cell_x_ < min_cell_x_) {
+    min_cell_x_ = max_cell_x_ = cell_x;
+    min_cell_y_ = max_cell_y_ = cell_y;
+  } else {
+    min_cell_x_ = std::min(min_cell_x_, cell_x);
+    min_cell_y_ = std::min(min_cell_y_, cell_y);
+    max_cell_x_ = std::max(max_cell_x_, cell_x);
+    max_cell_y_ = std::max(max_cell_y_, cell_y);
+  }
+}
+
+void SpatialGrid::Move(entt::entity entity, float x, float y) {
+  auto* slot = FindSlot(entity);
+  if (!slot) {
+    Insert(entity, x, y);
+    return;
+  }
+
+  // Перемещение внутри ячейки - самый частый случай, он не затрагивает таблицу ячеек.
+  if (slot->cell == ToKey(ToCell(x), ToCell(y))) {
+    auto& item = cells_.find(slot->cell)->second[slot->index];
+    item.x = x;
+    item.y = y;
+    return;
+  }
+
+  Remove(entity);
+  Insert(entity, x, y);
+}
+
+void SpatialGrid::Remove(entt::entity entity) {
+  auto* slot = FindSlot(entity);
+  if (!slot) {
+    return;
+  }
+
+  auto it = cells_.find(slot->cell);
+  auto& items = it->second;
+
+  // Последняя сущность ячейки занимает место удаляемой.
+  const auto& last = items.back();
+  slots_[static_cast<size_t>(entt::to_entity(last.entity))].index = slot->index;
+  items[slot->index] = last;
+  items.pop_back();
+
+  if (items.empty()) {
+    cells_.erase(it);
+  }
+
+  *slot = Slot{};
+  size_--;
+}
+
+int32_t SpatialGrid::ToCell(float coordinate) const {
+  return static_cast<int32_t>(std::floor(coordinate * inverse_cell_size_));
+}
+
+uint64_t SpatialGrid::ToKey(int32_t cell_x, int32_t cell_y) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(cell_x)) << 32) | static_cast<uint32_t>(cell_y);
+}
+
+SpatialGrid::Slot* SpatialGrid::FindSlot(entt::entity entity) {
+  auto index = static_cast<size_t>(entt::to_entity(entity));
+  if (index >= slots_.size() || slots_[index].index == kNoIndex) {
+    return nullptr;
+  }
+  return &slots_[index];
+}
+
+} // namespace gb
@@ -0,0 +1,136 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SPATIAL_SPATIAL_GRID_H
+#define GUIDING_BREEZE_SRC_CORE_SPATIAL_SPATIAL_GRID_H
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace gb {
+
+/**
+ * @brief Равномерная сетка положений сущностей с TransformComponent.
+ *
+ * Сетка подписывается на сигналы реестра on_construct/on_update/on_destroy компонента
+ * TransformComponent и обновляется по одной сущности за сигнал, поэтому полный обход
+ * реестра не требуется ни при изменениях, ни при запросах.
+ *
+ * Результаты запросов возвращаются в виде span на внутренний буфер, который переиспользуется
+ * между запросами и не выделяет память после прогрева.
+ *
+ * @note Положение нужно изменять через registry.patch/replace, иначе сигнал on_update не
+ * отправляется; при прямой записи в компонент следует вызвать Refresh.
+ */
+class SpatialGrid final {
+private:
+  static constexpr auto kNoIndex = std::numeric_limits<uint32_t>::max(); //< Индекс сущности, отсутствующей в сетке
+
+  struct Item {
+    entt::entity entity; //< Сущность
+    float x;             //< Координата X сущности
+    float y;             //< Координата Y сущности
+  };
+
+  struct Slot {
+    uint64_t cell{0};         //< Ключ ячейки, в которой находится сущность
+    uint32_t index{kNoIndex}; //< Индекс сущности в массиве ячейки
+  };
+
+private:
+  entt::registry* registry_;                               //< Реестр сущностей
+  float cell_size_;                                        //< Размер стороны ячейки
+  float inverse_cell_size_;                                //< Величина, обратная размеру ячейки
+  std::unordered_map<uint64_t, std::vector<Item>> cells_;  //< Сущности по ключам ячеек
+  std::vector<Slot> slots_;                                //< Положение сущностей в ячейках по индексу сущности
+  size_t size_{0};                                         //< Количество сущностей в сетке
+  int32_t min_cell_x_{0};                                  //< Наименьший X занятых ячеек; границы только расширяются
+  int32_t min_cell_y_{0};                                  //< Наименьший Y занятых ячеек
+  int32_t max_cell_x_{-1};                                 //< Наибольший X занятых ячеек
+  int32_t max_cell_y_{-1};                                 //< Наибольший Y занятых ячеек
+  std::vector<entt::entity> results_;                      //< Буфер результатов запросов
+  std::vector<std::pair<float, entt::entity>> nearest_;    //< Куча кандидатов поиска ближайших
+
+public:
+  /**
+   * @brief Создать сетку и заполнить ее уже существующими сущностями.
+   *
+   * @param registry Реестр сущностей; должен пережить сетку.
+   * @param cell_size Размер стороны ячейки; лучше брать порядка радиуса типичного запроса.
+   */
+  SpatialGrid(entt::registry* registry, float cell_size);
+  SpatialGrid(const SpatialGrid&) = delete;
+  SpatialGrid(SpatialGrid&&) = delete;
+  ~SpatialGrid() noexcept;
+
+public:
+  SpatialGrid& operator=(const SpatialGrid&) = delete;
+  SpatialGrid& operator=(SpatialGrid&&) = delete;
+
+public:
+  /**
+   * @brief Найти сущности внутри прямоугольника, включая границы.
+   *
+   * @return std::span<const entt::entity> Сущности; действительны до следующего запроса.
+   */
+  [[nodiscard]] std::span<const entt::entity> QueryRange(float min_x, float min_y, float max_x, float max_y);
+
+  /**
+   * @brief Найти сущности внутри круга, включая границу.
+   *
+   * @return std::span<const entt::entity> Сущности; действительны до следующего запроса.
+   */
+  [[nodiscard]] std::span<const entt::entity> QueryRadius(float x, float y, float radius);
+
+  /**
+   * @brief Найти не более count ближайших к точке сущностей.
+   *
+   * @return std::span<const entt::entity> Сущности по возрастанию расстояния; действительны до следующего запроса.
+   */
+  [[nodiscard]] std::span<const entt::entity> QueryNearest(float x, float y, size_t count);
+
+  /**
+   * @brief Перечитать положение сущности из TransformComponent.
+   *
+   * @param entity Сущность.
+   */
+  void Refresh(entt::entity entity);
+
+  /**
+   * @brief Получить количество сущностей в сетке.
+   */
+  [[nodiscard]] size_t GetSize() const;
+
+  /**
+   * @brief Получить количество непустых ячеек.
+   */
+  [[nodiscard]] size_t GetCellCount() const;
+
+  /**
+   * @brief Получить размер стороны ячейки.
+   */
+  [[nodiscard]] float GetCellSize() const;
+
+private:
+  void OnConstruct(entt::registry& registry, entt::entity entity);
+  void OnUpdate(entt::registry& registry, entt::entity entity);
+  void OnDestroy(entt::registry& registry, entt::entity entity);
+
+  void Insert(entt::entity entity, float x, float y);
+  void Move(entt::entity entity, float x, float y);
+  void Remove(entt::entity entity);
+
+  [[nodiscard]] int32_t ToCell(float coordinate) const;
+  [[nodiscard]] static uint64_t ToKey(int32_t cell_x, int32_t cell_y);
+  [[nodiscard]] Slot* FindSlot(entt::entity entity);
+
+  template<typename Func>
+  void ForEachCell(int32_t min_x, int32_t min_y, int32_t max_x, int32_t max_y, Func&& func) const;
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_SPATIAL_SPATIAL_GRID_H
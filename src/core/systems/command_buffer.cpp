@@ -0,0 +1,83 @@
+#include "command_buffer.hpp"
+
+namespace gb {
+
+CommandBuffer::TempEntity CommandBuffer::Create() {
+  command_count_++;
+  return TempEntity{created_count_++};
+}
+
+void CommandBuffer::Destroy(entt::entity entity) {
+  destroys_.push_back(ToTarget(entity));
+  command_count_++;
+}
+
+void CommandBuffer::Destroy(TempEntity entity) {
+  destroys_.push_back(ToTarget(entity));
+  command_count_++;
+}
+
+void CommandBuffer::Playback(entt::registry& registry) {
+  if (command_count_ == 0) {
+    return;
+  }
+
+  created_.resize(created_count_);
+  registry.create(created_.begin(), created_.end());
+
+  for (auto& [id, batch] : batches_) {
+    batch->Emplace(registry, created_);
+  }
+
+  for (auto& [id, batch] : batches_) {
+    batch->Remove(registry, created_);
+    batch->Clear();
+  }
+
+  if (!destroys_.empty()) {
+    std::vector<entt::entity> entities;
+    entities.reserve(destroys_.size());
+    for (auto target : destroys_) {
+      auto entity = Resolve(target, created_);
+      if (registry.valid(entity)) {
+        entities.push_back(entity);
+      }
+    }
+
+    std::sort(entities.begin(), entities.end(), [](auto lhs, auto rhs) {
+      return entt::to_integral(lhs) < entt::to_integral(rhs);
+    });
+    entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+    registry.destroy(entities.begin(), entities.end());
+    destroys_.clear();
+  }
+
+  created_.clear();
+  created_count_ = 0;
+  command_count_ = 0;
+}
+
+size_t CommandBuffer::GetCommandCount() const {
+  return command_count_;
+}
+
+bool CommandBuffer::IsEmpty() const {
+  return command_count_ == 0;
+}
+
+uint64_t CommandBuffer::ToTarget(entt::entity entity) {
+  return entt::to_integral(entity);
+}
+
+uint64_t CommandBuffer::ToTarget(TempEntity entity) {
+  return kTempFlag | static_cast<uint32_t>(entity);
+}
+
+entt::entity CommandBuffer::Resolve(uint64_t target, std::span<const entt::entity> created) {
+  if (target & kTempFlag) {
+    return created[static_cast<uint32_t>(target)];
+  }
+  return entt::entity{static_cast<entt::id_type>(target)};
+}
+
+} // namespace gb
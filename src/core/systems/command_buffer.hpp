@@ -0,0 +1,250 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SYSTEMS_COMMAND_BUFFER_H
+#define GUIDING_BREEZE_SRC_CORE_SYSTEMS_COMMAND_BUFFER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace gb {
+
+/**
+ * @brief Буфер отложенных структурных изменений реестра.
+ *
+ * Команды только записываются и не обращаются к реестру, поэтому буфер можно заполнять
+ * во время перебора представлений и из рабочих потоков: каждому потоку - свой буфер.
+ * Воспроизведение выполняется в точке синхронизации в фиксированном порядке:
+ *   1. создаются все временные сущности - одним вызовом registry.create;
+ *   2. добавляются компоненты - по типам, в порядке первого использования типа;
+ *      внутри типа сущности сортируются, и новые компоненты вставляются одним registry.insert;
+ *   3. удаляются компоненты;
+ *   4. уничтожаются сущности.
+ * Если один компонент добавлен сущности несколько раз, остается последнее значение; если
+ * у сущности он уже есть, значение заменяется. Команды для уже уничтоженных сущностей пропускаются.
+ */
+class alignas(64) CommandBuffer final {
+public:
+  /**
+   * @brief Временная сущность, созданная буфером; получает настоящий идентификатор при воспроизведении.
+   *
+   * @note Действительна только в командах буфера, который ее создал, и до его воспроизведения.
+   */
+  enum class TempEntity : uint32_t {};
+
+private:
+  static constexpr uint64_t kTempFlag = uint64_t{1} << 32; //< Признак временной сущности в цели команды
+
+  /**
+   * @brief Команды для компонентов одного типа.
+   */
+  class BatchBase {
+  public:
+    virtual ~BatchBase() noexcept = default;
+
+  public:
+    virtual void Emplace(entt::registry& registry, std::span<const entt::entity> created) = 0;
+    virtual void Remove(entt::registry& registry, std::span<const entt::entity> created) = 0;
+    virtual void Clear() = 0;
+  };
+
+  template<typename Component>
+  class Batch final : public BatchBase {
+  private:
+    std::vector<uint64_t> targets_;                        //< Цели добавления
+    std::vector<Component> values_;                        //< Добавляемые значения; для пустых компонентов не заполняется
+    std::vector<uint64_t> removes_;                        //< Цели удаления
+    std::vector<std::pair<entt::entity, uint32_t>> order_; //< Сущности и индексы команд, отсортированные по сущностям
+    std::vector<entt::entity> entities_;                   //< Сущности вставки или удаления
+    std::vector<Component> inserted_;                      //< Значения вставки в порядке сущностей
+
+  public:
+    template<typename... Args>
+    void Add(uint64_t target, Args&&... args) {
+      targets_.push_back(target);
+      if constexpr (std::is_empty_v<Component>) {
+        // У пустого компонента-метки нет значения: реестр хранит только сущности.
+        static_assert(sizeof...(Args) == 0, "Компонент-метка добавляется без аргументов");
+      } else if constexpr (std::is_aggregate_v<Component>) {
+        values_.push_back(Component{std::forward<Args>(args)...});
+      } else {
+        values_.emplace_back(std::forward<Args>(args)...);
+      }
+    }
+
+    void AddRemove(uint64_t target) {
+      removes_.push_back(target);
+    }
+
+    void Emplace(entt::registry& registry, std::span<const entt::entity> created) override {
+      if (targets_.empty()) {
+        return;
+      }
+
+      order_.clear();
+      for (auto i = size_t{0}; i < targets_.size(); i++) {
+        order_.emplace_back(Resolve(targets_[i], created), static_cast<uint32_t>(i));
+      }
+
+      // Сортировка по сущности делает обращения к разреженному массиву хранилища последовательными.
+      std::sort(order_.begin(), order_.end(), [](const auto& lhs, const auto& rhs) {
+        return entt::to_integral(lhs.first) < entt::to_integral(rhs.first)
+          || (lhs.first == rhs.first && lhs.second < rhs.second);
+      });
+
+      auto& storage = registry.storage<Component>();
+      entities_.clear();
+      inserted_.clear();
+
+      for (auto i = size_t{0}; i < order_.size(); i++) {
+        auto [entity, index] = order_[i];
+        if ((i + 1 < order_.size() && order_[i + 1].first == entity) || !registry.valid(entity)) {
+          continue;
+        }
+
+        if constexpr (std::is_empty_v<Component>) {
+          if (storage.contains(entity)) {
+            registry.emplace_or_replace<Component>(entity);
+          } else {
+            entities_.push_back(entity);
+          }
+        } else if (storage.contains(entity)) {
+          registry.replace<Component>(entity, std::move(values_[index]));
+        } else {
+          entities_.push_back(entity);
+          inserted_.push_back(std::move(values_[index]));
+        }
+      }
+
+      if constexpr (std::is_empty_v<Component>) {
+        registry.insert<Component>(entities_.begin(), entities_.end());
+      } else {
+        registry.insert<Component>(entities_.begin(), entities_.end(), inserted_.begin());
+      }
+    }
+
+    void Remove(entt::registry& registry, std::span<const entt::entity> created) override {
+      if (removes_.empty()) {
+        return;
+      }
+
+      entities_.clear();
+      for (auto target : removes_) {
+        entities_.push_back(Resolve(target, created));
+      }
+
+      std::sort(entities_.begin(), entities_.end(), [](auto lhs, auto rhs) {
+        return entt::to_integral(lhs) < entt::to_integral(rhs);
+      });
+      entities_.erase(std::unique(entities_.begin(), entities_.end()), entities_.end());
+      entities_.erase(
+        std::remove_if(entities_.begin(), entities_.end(), [&registry](auto entity) { return !registry.valid(entity); }),
+        entities_.end()
+      );
+
+      registry.remove<Component>(entities_.begin(), entities_.end());
+    }
+
+    void Clear() override {
+      targets_.clear();
+      values_.clear();
+      removes_.clear();
+      inserted_.clear();
+    }
+  };
+
+private:
+  std::vector<std::pair<entt::id_type, std::unique_ptr<BatchBase>>> batches_; //< Команды по типам в порядке первого использования
+  std::vector<uint64_t> destroys_;                                            //< Цели уничтожения
+  std::vector<entt::entity> created_;                                         //< Идентификаторы временных сущностей при воспроизведении
+  uint32_t created_count_{0};                                                 //< Количество временных сущностей
+  size_t command_count_{0};                                                   //< Количество записанных команд
+
+public:
+  CommandBuffer() = default;
+  CommandBuffer(const CommandBuffer&) = delete;
+  CommandBuffer(CommandBuffer&&) = default;
+  ~CommandBuffer() noexcept = default;
+
+public:
+  CommandBuffer& operator=(const CommandBuffer&) = delete;
+  CommandBuffer& operator=(CommandBuffer&&) = default;
+
+public:
+  /**
+   * @brief Создать временную сущность.
+   */
+  [[nodiscard]] TempEntity Create();
+
+  /**
+   * @brief Уничтожить сущность.
+   */
+  void Destroy(entt::entity entity);
+  void Destroy(TempEntity entity);
+
+  /**
+   * @brief Добавить сущности компонент или заменить имеющийся.
+   *
+   * @tparam Component Тип компонента.
+   * @param args Аргументы конструктора компонента; значение создается сразу.
+   */
+  template<typename Component, typename... Args>
+  void Emplace(entt::entity entity, Args&&... args) {
+    GetBatch<Component>().Add(ToTarget(entity), std::forward<Args>(args)...);
+    command_count_++;
+  }
+
+  template<typename Component, typename... Args>
+  void Emplace(TempEntity entity, Args&&... args) {
+    GetBatch<Component>().Add(ToTarget(entity), std::forward<Args>(args)...);
+    command_count_++;
+  }
+
+  /**
+   * @brief Удалить компонент сущности, если он есть.
+   */
+  template<typename Component>
+  void Remove(entt::entity entity) {
+    GetBatch<Component>().AddRemove(ToTarget(entity));
+    command_count_++;
+  }
+
+  /**
+   * @brief Воспроизвести команды и очистить буфер.
+   *
+   * @param registry Реестр сущностей; не должен использоваться другими потоками во время вызова.
+   */
+  void Playback(entt::registry& registry);
+
+  /**
+   * @brief Получить количество записанных команд.
+   */
+  [[nodiscard]] size_t GetCommandCount() const;
+
+  [[nodiscard]] bool IsEmpty() const;
+
+private:
+  template<typename Component>
+  Batch<Component>& GetBatch() {
+    auto id = entt::type_hash<Component>::value();
+    for (auto& [batch_id, batch] : batches_) {
+      if (batch_id == id) {
+        return static_cast<Batch<Component>&>(*batch);
+      }
+    }
+
+    return static_cast<Batch<Component>&>(*batches_.emplace_back(id, std::make_unique<Batch<Component>>()).second);
+  }
+
+  [[nodiscard]] static uint64_t ToTarget(entt::entity entity);
+  [[nodiscard]] static uint64_t ToTarget(TempEntity entity);
+  [[nodiscard]] static entt::entity Resolve(uint64_t target, std::span<const entt::entity> created);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_SYSTEMS_COMMAND_BUFFER_H
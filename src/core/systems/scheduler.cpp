@@ -0,0 +1,160 @@
+#include "scheduler.hpp"
+
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <memory>
+#include <typeinfo>
+#include <utility>
+
+#if defined(__GNUG__)
+  #include <cxxabi.h>
+#endif
+
+namespace gb {
+
+namespace {
+
+  /**
+   * @brief Получить читаемое имя типа системы.
+   *
+   * @param system Система.
+   * @return const char* Имя со временем жизни до конца работы программы.
+   */
+  [[nodiscard]] const char* GetSystemName(const System& system) {
+    const auto* name = typeid(system).name();
+
+#if defined(__GNUG__)
+    auto status = 0;
+    std::unique_ptr<char, decltype(&std::free)> demangled(
+      abi::__cxa_demangle(name, nullptr, nullptr, &status), &std::free
+    );
+
+    if (status == 0 && demangled) {
+      return Profiler::Intern(demangled.get());
+    }
+#endif
+
+    return Profiler::Intern(name);
+  }
+
+} // namespace
+
+Scheduler::Scheduler(ThreadPool* pool) : pool_(pool), tasks_(pool) {
+  assert(pool);
+}
+
+System& Scheduler::Add(std::unique_ptr<System> system) {
+  assert(system);
+
+  auto& node = nodes_.emplace_back(std::make_unique<Node>());
+  node->system = std::move(system);
+  node->system->thread_pool_ = pool_;
+  node->system->tasks_ = &tasks_;
+  // Буферы создаются заранее: во время тика их массив не должен изменяться.
+  node->system->commands_.resize(pool_->GetWorkerCount() + 1);
+  node->name = GetSystemName(*node->system);
+  dirty_ = true;
+
+  return *node->system;
+}
+
+void Scheduler::Remove(const System& system) {
+  auto it = std::find_if(nodes_.begin(), nodes_.end(), [&system](const auto& node) {
+    return node->system.get() == &system;
+  });
+  assert(it != nodes_.end());
+
+  // Задачи могут обращаться к системе, а код системы модуля - выгружаться сразу после удаления.
+  tasks_.Cancel(&system);
+  nodes_.erase(it);
+  dirty_ = true;
+}
+
+void Scheduler::Update(float delta) {
+  // Ни одна система еще не выполняется, поэтому продолжения задач могут изменять реестр.
+  tasks_.Update();
+
+  if (nodes_.empty()) {
+    return;
+  }
+
+  if (dirty_) {
+    Build();
+  }
+
+  for (auto& node : nodes_) {
+    node->remaining.store(node->dependency_count, std::memory_order_relaxed);
+  }
+
+  delta_ = delta;
+  unfinished_.store(nodes_.size(), std::memory_order_relaxed);
+  for (auto index : roots_) {
+    pool_->Submit([this, index] { Run(index); });
+  }
+
+  pool_->WaitUntil([this] { return unfinished_.load(std::memory_order_acquire) == 0; });
+
+  // Точка синхронизации: структурные изменения применяются в порядке добавления систем.
+  GB_PROFILE_ZONE("Точка синхронизации");
+  for (auto& node : nodes_) {
+    node->system->ApplyDeferred();
+  }
+}
+
+void Scheduler::Clear() {
+  for (auto& node : nodes_) {
+    tasks_.Cancel(node->system.get());
+  }
+  nodes_.clear();
+  roots_.clear();
+  dirty_ = false;
+}
+
+TaskScheduler& Scheduler::GetTasks() {
+  return tasks_;
+}
+
+void Scheduler::Build() {
+  roots_.clear();
+
+  for (auto& node : nodes_) {
+    node->dependents.clear();
+    node->dependency_count = 0;
+  }
+
+  for (auto i = size_t{0}; i < nodes_.size(); i++) {
+    for (auto j = size_t{0}; j < i; j++) {
+      if (!nodes_[i]->system->IsCompatibleWith(*nodes_[j]->system)) {
+        nodes_[j]->dependents.push_back(i);
+        nodes_[i]->dependency_count++;
+      }
+    }
+
+    if (nodes_[i]->dependency_count == 0) {
+      roots_.push_back(i);
+    }
+  }
+
+  dirty_ = false;
+}
+
+void Scheduler::Run(size_t index) {
+  auto& node = *nodes_[index];
+  {
+    const Profiler::ScopedZone zone(node.name);
+    node.system->Update(delta_);
+  }
+
+  for (auto dependent : node.dependents) {
+    if (nodes_[dependent]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      pool_->Submit([this, dependent] { Run(dependent); });
+    }
+  }
+
+  unfinished_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+} // namespace gb
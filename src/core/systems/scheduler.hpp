@@ -0,0 +1,92 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SYSTEMS_SCHEDULER_H
+#define GUIDING_BREEZE_SRC_CORE_SYSTEMS_SCHEDULER_H
+
+#include "core/jobs/task_scheduler.hpp"
+#include "core/jobs/thread_pool.hpp"
+#include "core/systems/system.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace gb {
+
+/**
+ * @brief Планировщик систем.
+ *
+ * По объявленным системами наборам компонентов строится граф зависимостей: система зависит
+ * от каждой ранее добавленной системы, с которой она конфликтует. Системы без общих
+ * зависимостей выполняются параллельно в пуле потоков, а результат совпадает
+ * с последовательным выполнением в порядке добавления.
+ *
+ * Долгая работа систем выполняется задачами планировщика задач (см. System::Launch); их продолжения
+ * в потоке логики выполняются в начале тика, до систем.
+ */
+class Scheduler final {
+private:
+  struct Node {
+    std::unique_ptr<System> system;      //< Система
+    const char* name{nullptr};           //< Имя системы для профилировщика
+    std::vector<size_t> dependents;      //< Индексы систем, ожидающих завершения этой
+    size_t dependency_count{0};          //< Количество систем, которых ожидает эта
+    std::atomic<size_t> remaining{0};    //< Количество незавершенных зависимостей в текущем тике
+  };
+
+private:
+  ThreadPool* pool_;
+  std::vector<std::unique_ptr<Node>> nodes_;
+  std::vector<size_t> roots_;
+  bool dirty_{false};
+  float delta_{0.0F};                  //< Длительность текущего тика; задачи систем захватывают только индекс
+  std::atomic<size_t> unfinished_{0};  //< Количество незавершенных систем в текущем тике
+  TaskScheduler tasks_; //< Задачи систем; уничтожаются раньше систем, которые могли их запустить
+
+public:
+  explicit Scheduler(ThreadPool* pool);
+  Scheduler(const Scheduler&) = delete;
+  Scheduler(Scheduler&&) = delete;
+  ~Scheduler() noexcept = default;
+
+public:
+  Scheduler& operator=(const Scheduler&) = delete;
+  Scheduler& operator=(Scheduler&&) = delete;
+
+public:
+  /**
+   * @brief Добавить систему.
+   *
+   * @param system Система.
+   * @return System& Добавленная система.
+   */
+  System& Add(std::unique_ptr<System> system);
+
+  /**
+   * @brief Удалить систему.
+   *
+   * @param system Система, добавленная через Add; уничтожается вместе с запущенными ей задачами.
+   * @note Вызывается между тиками.
+   */
+  void Remove(const System& system);
+
+  /**
+   * @brief Выполнить один тик всех систем и применить их отложенные изменения.
+   *
+   * @param delta Фиксированная длительность тика в секундах.
+   */
+  void Update(float delta);
+
+  /**
+   * @brief Удалить все системы.
+   */
+  void Clear();
+
+  [[nodiscard]] TaskScheduler& GetTasks();
+
+private:
+  void Build();
+  void Run(size_t index);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_SYSTEMS_SCHEDULER_H
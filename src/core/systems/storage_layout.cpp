@@ -0,0 +1,77 @@
+#include "storage_layout.hpp"
+
+#include "profiler/profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+namespace gb {
+
+namespace {
+
+  [[nodiscard]] bool Contains(const std::vector<entt::id_type>& types, entt::id_type type) {
+    return std::find(types.begin(), types.end(), type) != types.end();
+  }
+
+} // namespace
+
+StorageLayout::StorageLayout(entt::registry* registry) : registry_(registry) {
+}
+
+void StorageLayout::Update() {
+  auto due = false;
+  for (auto& rule : rules_) {
+    if (--rule.countdown == 0) {
+      due = true;
+    }
+  }
+
+  if (!due) {
+    return;
+  }
+
+  GB_PROFILE_ZONE("Упорядочивание хранилищ");
+  auto begin = std::chrono::steady_clock::now();
+
+  // Правила выполняются в порядке объявления, чтобы выравнивание шло после сортировки ведущего хранилища.
+  for (auto& rule : rules_) {
+    if (rule.countdown == 0) {
+      rule.sort(*registry_);
+      rule.countdown = rule.interval;
+      stats_.sorts++;
+    }
+  }
+
+  stats_.last_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+const StorageLayout::Stats& StorageLayout::GetStats() const {
+  return stats_;
+}
+
+void StorageLayout::Claim(std::initializer_list<entt::id_type> types) {
+  for (auto type : types) {
+    auto sorted = std::any_of(rules_.begin(), rules_.end(), [type](const auto& rule) { return rule.type == type; });
+    if (Contains(owned_, type) || sorted) {
+      throw std::logic_error("Хранилище уже принадлежит группе или упорядочивается отдельно");
+    }
+  }
+
+  owned_.insert(owned_.end(), types.begin(), types.end());
+}
+
+void StorageLayout::AddRule(entt::id_type type, uint32_t interval, std::function<void(entt::registry&)> sort) {
+  if (interval == 0) {
+    throw std::logic_error("Период упорядочивания должен быть больше нуля");
+  }
+  if (Contains(owned_, type)) {
+    throw std::logic_error("Хранилище, принадлежащее группе, нельзя упорядочивать отдельно");
+  }
+
+  rules_.push_back(Rule{type, interval, interval, std::move(sort)});
+  stats_.rules++;
+}
+
+} // namespace gb
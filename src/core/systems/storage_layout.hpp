@@ -0,0 +1,125 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_SYSTEMS_STORAGE_LAYOUT_H
+#define GUIDING_BREEZE_SRC_CORE_SYSTEMS_STORAGE_LAYOUT_H
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "entt/entt.hpp"
+
+namespace gb {
+
+/**
+ * @brief Управление расположением хранилищ компонентов в памяти.
+ *
+ * Два способа расположить часто перебираемые вместе компоненты подряд:
+ *   - Group объявляет владеющую группу: реестр держит сущности группы в начале упакованных
+ *     массивов всех ее хранилищ в одинаковом порядке, и перебор группы идет по параллельным
+ *     массивам без обращений к разреженным. Так же делается разбиение большого компонента на
+ *     структуру массивов: его горячие поля выносятся в отдельные компоненты (например, положение
+ *     и скорость), которые объявляются одной группой, а редко используемые поля остаются в
+ *     отдельном компоненте и не засоряют кэш при переборе;
+ *   - Align и Sort периодически упорядочивают хранилища, не принадлежащие группам, по порядку
+ *     перебора самой тяжелой системы: если система перебирает view<A, B>, хранилище B
+ *     выравнивается по A, и обращения к B становятся последовательными.
+ *
+ * Хранилище может принадлежать только одной группе и, пока принадлежит, не может упорядочиваться
+ * отдельно; нарушение этих правил - ошибка настройки и приводит к std::logic_error.
+ */
+class StorageLayout final {
+public:
+  struct Stats {
+    size_t groups{0};    //< Количество объявленных групп
+    size_t rules{0};     //< Количество правил упорядочивания
+    uint64_t sorts{0};   //< Общее количество выполненных упорядочиваний
+    double last_ms{0.0}; //< Длительность последнего упорядочивания в миллисекундах
+  };
+
+private:
+  struct Rule {
+    entt::id_type type;                        //< Упорядочиваемое хранилище
+    uint32_t interval;                         //< Период упорядочивания в тиках
+    uint32_t countdown;                        //< Количество тиков до следующего упорядочивания
+    std::function<void(entt::registry&)> sort; //< Функция упорядочивания
+  };
+
+private:
+  entt::registry* registry_;         //< Реестр сущностей
+  std::vector<entt::id_type> owned_; //< Хранилища, принадлежащие группам
+  std::vector<Rule> rules_;          //< Правила упорядочивания
+  Stats stats_;                      //< Статистика
+
+public:
+  /**
+   * @param registry Реестр сущностей; должен пережить объект.
+   */
+  explicit StorageLayout(entt::registry* registry);
+  StorageLayout(const StorageLayout&) = delete;
+  StorageLayout(StorageLayout&&) = delete;
+  ~StorageLayout() noexcept = default;
+
+public:
+  StorageLayout& operator=(const StorageLayout&) = delete;
+  StorageLayout& operator=(StorageLayout&&) = delete;
+
+public:
+  /**
+   * @brief Объявить владеющую группу.
+   *
+   * @tparam Owned Компоненты, хранилища которых принадлежат группе.
+   * @tparam Get Компоненты, которые группа только читает и не переупорядочивает.
+   * @note Вызывается при настройке реестра, до запуска систем: создание группы переупорядочивает
+   * уже существующие компоненты.
+   */
+  template<typename... Owned, typename... Get>
+  void Group(entt::get_t<Get...> get = entt::get_t<>{}) {
+    static_assert(sizeof...(Owned) > 0, "Группа должна владеть хотя бы одним компонентом");
+
+    Claim({entt::type_hash<Owned>::value()...});
+    static_cast<void>(registry_->group<Owned...>(get));
+    stats_.groups++;
+  }
+
+  /**
+   * @brief Периодически упорядочивать хранилище Follower по порядку хранилища Leader.
+   *
+   * @param interval Период в тиках; должен быть больше нуля.
+   */
+  template<typename Follower, typename Leader>
+  void Align(uint32_t interval) {
+    AddRule(entt::type_hash<Follower>::value(), interval, [](entt::registry& registry) {
+      registry.sort<Follower, Leader>();
+    });
+  }
+
+  /**
+   * @brief Периодически упорядочивать хранилище компонента по значениям.
+   *
+   * @param interval Период в тиках; должен быть больше нуля.
+   * @param compare Функция вида bool(const Component&, const Component&).
+   */
+  template<typename Component, typename Compare>
+  void Sort(uint32_t interval, Compare compare) {
+    AddRule(entt::type_hash<Component>::value(), interval, [compare](entt::registry& registry) {
+      registry.sort<Component>(compare);
+    });
+  }
+
+  /**
+   * @brief Выполнить правила, период которых истек.
+   *
+   * @note Вызывается раз в тик в точке синхронизации, когда ни одна система не выполняется.
+   */
+  void Update();
+
+  [[nodiscard]] const Stats& GetStats() const;
+
+private:
+  void Claim(std::initializer_list<entt::id_type> types);
+  void AddRule(entt::id_type type, uint32_t interval, std::function<void(entt::registry&)> sort);
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_SYSTEMS_STORAGE_LAYOUT_H
@@ -1,14 +1,64 @@
 #include "system.hpp"
+#include <algorithm>
 #include <cassert>
 
 namespace gb {
 
-System::System(entt::registry* registry) : registry_(registry) {
+namespace {
+
+  /**
+   * @brief Проверить наличие общих элементов в двух наборах идентификаторов.
+   */
+  [[nodiscard]] bool Intersects(const std::vector<entt::id_type>& lhs, const std::vector<entt::id_type>& rhs) {
+    return std::any_of(lhs.begin(), lhs.end(), [&rhs](auto id) {
+      return std::find(rhs.begin(), rhs.end(), id) != rhs.end();
+    });
+  }
+
+} // namespace
+
+System::System(entt::registry* registry) : registry_(registry), commands_(1) {
   assert(registry);
 }
 
+void System::ApplyDeferred() {
+  for (auto& commands : commands_) {
+    commands.Playback(*registry_);
+  }
+}
+
+bool System::IsCompatibleWith(const System& other) const {
+  if (IsExclusive() || other.IsExclusive()) {
+    return false;
+  }
+
+  return !Intersects(writes_, other.writes_)
+    && !Intersects(writes_, other.reads_)
+    && !Intersects(reads_, other.writes_);
+}
+
 entt::registry& System::GetRegistry() const {
   return *registry_;
 }
 
-} // namespace gb
\ No newline at end of file
+TaskScheduler& System::GetTasks() const {
+  assert(tasks_);
+  return *tasks_;
+}
+
+CommandBuffer& System::GetCommands() {
+  // Буфер потока пула может в это же время заполнять перебор системы или воспроизводить планировщик.
+  assert(!TaskScheduler::IsInBackground());
+
+  if (!thread_pool_) {
+    return commands_.front();
+  }
+
+  return commands_[thread_pool_->GetCurrentWorkerIndex()];
+}
+
+bool System::IsExclusive() const {
+  return reads_.empty() && writes_.empty();
+}
+
+} // namespace gb
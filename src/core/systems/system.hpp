@@ -1,17 +1,36 @@
 #ifndef GUIDING_BREEZE_SRC_CORE_SYSTEMS_SYSTEM_H
 #define GUIDING_BREEZE_SRC_CORE_SYSTEMS_SYSTEM_H
 
+#include "core/jobs/parallel_each.hpp"
+#include "core/jobs/task.hpp"
+#include "core/jobs/task_scheduler.hpp"
+#include "core/jobs/thread_pool.hpp"
+#include "core/systems/command_buffer.hpp"
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
 #include "entt/entt.hpp"
 
 namespace gb {
 
+class Scheduler;
+
 class System {
+  friend class Scheduler;
+
 private:
   entt::registry* registry_;
+  ThreadPool* thread_pool_{nullptr};
+  TaskScheduler* tasks_{nullptr};
+  std::vector<entt::id_type> reads_;
+  std::vector<entt::id_type> writes_;
+  std::vector<CommandBuffer> commands_;
 
 public:
   explicit System(entt::registry* registry);
-  System(const System&) = default;
+  System(const System&) = delete;
   System(System&&) = default;
   virtual ~System() noexcept = default;
 
@@ -20,12 +39,136 @@ public:
   System& operator=(const System&) = delete;
 
 public:
-  virtual void Update() = 0;
+  /**
+   * @brief Обновить логику системы на один тик.
+   *
+   * @param delta Фиксированная длительность тика в секундах.
+   */
+  virtual void Update(float delta) = 0;
+
+  /**
+   * @brief Применить отложенные структурные изменения реестра из буферов команд всех потоков.
+   *
+   * @note Вызывается планировщиком в точке синхронизации, когда ни одна система не выполняется.
+   * Буферы воспроизводятся по порядку индексов потоков; при параллельном переборе распределение
+   * сущностей по потокам не фиксировано, поэтому от него не должен зависеть результат.
+   */
+  void ApplyDeferred();
+
+  /**
+   * @brief Проверить, может ли система выполняться одновременно с другой системой.
+   *
+   * @param other Другая система.
+   * @return true Если наборы компонентов систем не конфликтуют.
+   * @note Система, не объявившая ни одного компонента, считается работающей со всем реестром.
+   */
+  [[nodiscard]] bool IsCompatibleWith(const System& other) const;
 
 protected:
   [[nodiscard]] entt::registry& GetRegistry() const;
+
+  /**
+   * @brief Объявить компоненты, которые система только читает.
+   *
+   * @tparam Components Типы компонентов.
+   * @note Вызывается из конструктора наследника. Хранилища компонентов создаются сразу,
+   * чтобы во время параллельного выполнения реестр не изменялся.
+   */
+  template<typename... Components>
+  void Reads() {
+    (reads_.push_back(entt::type_hash<Components>::value()), ...);
+    (registry_->storage<Components>(), ...);
+  }
+
+  /**
+   * @brief Объявить компоненты, которые система изменяет.
+   *
+   * @tparam Components Типы компонентов.
+   * @note Вызывается из конструктора наследника.
+   */
+  template<typename... Components>
+  void Writes() {
+    (writes_.push_back(entt::type_hash<Components>::value()), ...);
+    (registry_->storage<Components>(), ...);
+  }
+
+  /**
+   * @brief Параллельно вызвать функцию для всех сущностей с заданными компонентами.
+   *
+   * @tparam Components Типы компонентов; первый определяет перебираемое хранилище.
+   * @param func Функция вида void(Components&...) или void(entt::entity, Components&...).
+   * @param grain Размер фрагмента в сущностях; 0 - выбрать автоматически.
+   * @note Без пула потоков (система вне планировщика) перебор выполняется последовательно.
+   */
+  template<typename... Components, typename Func>
+  void ParallelEach(Func&& func, size_t grain = 0) {
+    if (thread_pool_) {
+      gb::ParallelEach<Components...>(*thread_pool_, *registry_, std::forward<Func>(func), grain);
+    }
+    else {
+      registry_->view<Components...>().each(std::forward<Func>(func));
+    }
+  }
+
+  /**
+   * @brief Параллельно свернуть значения для всех сущностей с заданными компонентами.
+   *
+   * @tparam Components Типы компонентов; первый определяет перебираемое хранилище.
+   * @param init Нейтральный элемент для combine; начальное значение каждого аккумулятора.
+   * @param func Функция вида void(Result& accumulator, Components&...).
+   * @param combine Функция вида void(Result& target, const Result& source).
+   * @param grain Размер фрагмента в сущностях; 0 - выбрать автоматически.
+   * @return Result Свернутое значение; не зависит от количества потоков.
+   */
+  template<typename... Components, typename Result, typename Func, typename Combine>
+  Result ParallelReduce(const Result& init, Func&& func, Combine&& combine, size_t grain = 0) {
+    if (thread_pool_) {
+      return gb::ParallelReduce<Components...>(
+        *thread_pool_, *registry_, init, std::forward<Func>(func), std::forward<Combine>(combine), grain
+      );
+    }
+
+    auto result = init;
+    registry_->view<Components...>().each([&result, &func](auto&... components) {
+      func(result, components...);
+    });
+    return result;
+  }
+
+  /**
+   * @brief Запустить долгую работу в пуле потоков, не задерживая тик.
+   *
+   * @param task Задача; может переключаться между пулом и потоком логики ожиданиями GetTasks().
+   * @param priority Приоритет задачи.
+   * @return TaskHandle<T> Дескриптор; результат забирается в одном из следующих тиков, когда IsReady.
+   * @note Задачи отменяются при удалении системы из планировщика. К реестру задача обращается только
+   * после co_await GetTasks().MainThread(): там системы не выполняются.
+   */
+  template<typename T>
+  TaskHandle<T> Launch(Task<T> task, TaskPriority priority = TaskPriority::Normal) {
+    assert(tasks_);
+    return tasks_->Launch(std::move(task), priority, this);
+  }
+
+  /**
+   * @brief Получить планировщик задач для ожиданий внутри задач системы.
+   */
+  [[nodiscard]] TaskScheduler& GetTasks() const;
+
+  /**
+   * @brief Получить буфер команд вызывающего потока для отложенного создания и удаления
+   * сущностей и компонентов.
+   *
+   * @return CommandBuffer& Буфер; воспроизводится в точке синхронизации после обновления систем.
+   * @note Безопасно вызывать из функций ParallelEach и ParallelReduce: каждый поток пула
+   * получает собственный буфер. Из задачи системы вызывается только после co_await GetTasks().MainThread().
+   */
+  [[nodiscard]] CommandBuffer& GetCommands();
+
+private:
+  [[nodiscard]] bool IsExclusive() const;
 };
 
 } // namespace gb
 
-#endif // GUIDING_BREEZE_SRC_CORE_SYSTEMS_SYSTEM_H
\ No newline at end of file
+#endif // GUIDING_BREEZE_SRC_CORE_SYSTEMS_SYSTEM_H
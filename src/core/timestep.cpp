@@ -0,0 +1,71 @@
+#include "timestep.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace gb {
+
+FixedTimestep::FixedTimestep(uint32_t tick_rate, uint32_t max_ticks_per_frame)
+  : tick_rate_(tick_rate),
+    max_ticks_per_frame_(max_ticks_per_frame),
+    tick_duration_(1.0 / tick_rate) {
+  assert(tick_rate > 0);
+  assert(max_ticks_per_frame > 0);
+}
+
+uint32_t FixedTimestep::Advance(double frame_seconds) {
+  accumulator_ += frame_seconds > 0.0 ? frame_seconds : 0.0;
+
+  auto ticks = static_cast<uint64_t>(accumulator_ / tick_duration_);
+  if (ticks > max_ticks_per_frame_) {
+    dropped_ticks_ += ticks - max_ticks_per_frame_;
+    accumulator_ = std::fmod(accumulator_, tick_duration_) + max_ticks_per_frame_ * tick_duration_;
+    ticks = max_ticks_per_frame_;
+  }
+
+  accumulator_ -= ticks * tick_duration_;
+  tick_count_ += ticks;
+
+  return static_cast<uint32_t>(ticks);
+}
+
+float FixedTimestep::GetAlpha() const {
+  return static_cast<float>(accumulator_ / tick_duration_);
+}
+
+void FixedTimestep::SetTickRate(uint32_t tick_rate) {
+  assert(tick_rate > 0);
+
+  // Сохраняем долю текущего тика, чтобы интерполяция не прыгала при смене частоты.
+  auto alpha = accumulator_ / tick_duration_;
+  tick_rate_ = tick_rate;
+  tick_duration_ = 1.0 / tick_rate;
+  accumulator_ = alpha * tick_duration_;
+}
+
+uint32_t FixedTimestep::GetTickRate() const {
+  return tick_rate_;
+}
+
+float FixedTimestep::GetTickDuration() const {
+  return static_cast<float>(tick_duration_);
+}
+
+void FixedTimestep::SetMaxTicksPerFrame(uint32_t max_ticks_per_frame) {
+  assert(max_ticks_per_frame > 0);
+  max_ticks_per_frame_ = max_ticks_per_frame;
+}
+
+uint32_t FixedTimestep::GetMaxTicksPerFrame() const {
+  return max_ticks_per_frame_;
+}
+
+uint64_t FixedTimestep::GetTickCount() const {
+  return tick_count_;
+}
+
+uint64_t FixedTimestep::GetDroppedTicks() const {
+  return dropped_ticks_;
+}
+
+} // namespace gb
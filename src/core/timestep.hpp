@@ -0,0 +1,80 @@
+#ifndef GUIDING_BREEZE_SRC_CORE_TIMESTEP_H
+#define GUIDING_BREEZE_SRC_CORE_TIMESTEP_H
+
+#include <cstdint>
+
+namespace gb {
+
+/**
+ * @brief Накопитель времени для обновления логики с фиксированным шагом.
+ *
+ * Время кадра добавляется в аккумулятор, из которого извлекается целое число тиков
+ * фиксированной длительности. Остаток используется как коэффициент интерполяции при отрисовке.
+ */
+class FixedTimestep final {
+private:
+  uint32_t tick_rate_;           //< Количество тиков в секунду
+  uint32_t max_ticks_per_frame_; //< Максимальное количество тиков, догоняемых за один кадр
+  double tick_duration_;         //< Длительность одного тика в секундах
+  double accumulator_{0.0};      //< Накопленное, но еще не обработанное время в секундах
+  uint64_t tick_count_{0};       //< Общее количество выполненных тиков
+  uint64_t dropped_ticks_{0};    //< Общее количество тиков, отброшенных из-за ограничения
+
+public:
+  FixedTimestep(uint32_t tick_rate, uint32_t max_ticks_per_frame);
+
+public:
+  /**
+   * @brief Добавить время кадра и получить количество тиков, которые нужно выполнить.
+   *
+   * @param frame_seconds Время, прошедшее с прошлого кадра, в секундах.
+   * @return uint32_t Количество тиков; не превышает максимального количества за кадр.
+   * @note Если накоплено больше тиков, чем разрешено, лишнее время отбрасывается,
+   * чтобы медленные кадры не приводили к лавинообразному росту отставания.
+   */
+  [[nodiscard]] uint32_t Advance(double frame_seconds);
+
+  /**
+   * @brief Получить коэффициент интерполяции между последним и следующим тиком.
+   *
+   * @return float Значение в диапазоне [0; 1).
+   */
+  [[nodiscard]] float GetAlpha() const;
+
+  /**
+   * @brief Установить количество тиков в секунду.
+   *
+   * @param tick_rate Количество тиков в секунду; должно быть больше нуля.
+   */
+  void SetTickRate(uint32_t tick_rate);
+
+  [[nodiscard]] uint32_t GetTickRate() const;
+
+  /**
+   * @brief Получить длительность одного тика в секундах.
+   */
+  [[nodiscard]] float GetTickDuration() const;
+
+  /**
+   * @brief Установить максимальное количество тиков, догоняемых за один кадр.
+   *
+   * @param max_ticks_per_frame Максимальное количество тиков; должно быть больше нуля.
+   */
+  void SetMaxTicksPerFrame(uint32_t max_ticks_per_frame);
+
+  [[nodiscard]] uint32_t GetMaxTicksPerFrame() const;
+
+  /**
+   * @brief Получить общее количество выполненных тиков.
+   */
+  [[nodiscard]] uint64_t GetTickCount() const;
+
+  /**
+   * @brief Получить общее количество тиков, отброшенных из-за ограничения на кадр.
+   */
+  [[nodiscard]] uint64_t GetDroppedTicks() const;
+};
+
+} // namespace gb
+
+#endif // GUIDING_BREEZE_SRC_CORE_TIMESTEP_H
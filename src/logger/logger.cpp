@@ -1,7 +1,20 @@
 #include "logger.hpp"
 
+#include "logger/ring_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <iterator>
+#include <mutex>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
+
+#include "SDL_log.h"
 
 // Строка сброса цвета текста в консоли.
 #define STR_RESET_COLOR "\e[0m"
@@ -12,51 +25,121 @@
 
 namespace gb::Logger {
 
-/**
-  * @brief Получение информации косательно текущего времени в виде строки.
-  *
-  * @return std::string Строка с текущим временем в формате "YYYY-MM-DD HH:MM:SS".
-  */
-[[nodiscard]] std::string GetFormattedTime() {
-  auto now = std::chrono::system_clock::now();
-  auto time = std::chrono::system_clock::to_time_t(now);
-  auto tm = *std::localtime(&time);
+namespace {
 
-  std::ostringstream oss;
-  oss << std::put_time(&tm, "%H:%M:%S");
+  constexpr size_t kRecordSize = 512; //< Размер одной записи очереди в байтах
+  constexpr std::string_view kTruncationMarker = "…"; //< Отметка обрезанного сообщения
+  constexpr size_t kQueueCapacity = 1024; //< Вместимость очереди асинхронного вывода
+  constexpr size_t kBatchSize = 64 * 1024; //< Размер пакета, при превышении которого он записывается немедленно
+  constexpr auto kWakeInterval = std::chrono::milliseconds(10); //< Период пробуждения фонового потока
+  constexpr auto kMaxFlushInterval = std::chrono::milliseconds(100); //< Максимальное время удержания пакета без сброса
 
-  return oss.str();
-}
+  /**
+   * @brief Момент отправки сообщения.
+   */
+  struct Timestamp {
+    int64_t system_ns; //< Наносекунды от эпохи system_clock
+    int64_t steady_ns; //< Наносекунды от эпохи steady_clock
+  };
+
+  /**
+   * @brief Запись очереди асинхронного вывода.
+   */
+  struct Record {
+    Timestamp timestamp; //< Момент отправки сообщения
+    Level level;         //< Уровень логирования
+    uint16_t size;       //< Длина сообщения в байтах
+    char text[kRecordSize - sizeof(Timestamp) - sizeof(Level) - sizeof(uint16_t)]; //< Текст сообщения
+  };
+
+  /**
+   * @brief Кэш строкового представления текущей секунды в формате "HH:MM:SS".
+   *
+   * Строка пересчитывается только при смене секунды, поэтому localtime_r вызывается
+   * не чаще раза в секунду. Каждый поток записи владеет собственным кэшем.
+   */
+  class TimestampCache final {
+  private:
+    int64_t second_{-1}; //< Секунда от эпохи, для которой построена строка
+    char text_[8]{};     //< Строка "HH:MM:SS" без завершающего нуля
+
+  public:
+    /**
+     * @brief Получить строку времени для заданного момента.
+     *
+     * @param system_ns Наносекунды от эпохи system_clock.
+     * @return std::string_view Строка "HH:MM:SS".
+     */
+    [[nodiscard]] std::string_view Get(int64_t system_ns) {
+      auto second = system_ns / 1'000'000'000;
+
+      if (second != second_) {
+        auto time = static_cast<std::time_t>(second);
+        std::tm tm{};
+        localtime_r(&time, &tm);
+
+        WriteTwoDigits(text_ + 0, tm.tm_hour);
+        text_[2] = ':';
+        WriteTwoDigits(text_ + 3, tm.tm_min);
+        text_[5] = ':';
+        WriteTwoDigits(text_ + 6, tm.tm_sec);
+        second_ = second;
+      }
+
+      return std::string_view(text_, sizeof(text_));
+    }
+
+  private:
+    static void WriteTwoDigits(char* out, int value) {
+      out[0] = static_cast<char>('0' + value / 10);
+      out[1] = static_cast<char>('0' + value % 10);
+    }
+  };
+
+  RingBuffer<Record, kQueueCapacity> queue; //< Очередь сообщений для фонового потока
+  std::atomic<Mode> mode{Mode::Async}; //< Текущий режим вывода
+  std::atomic<OverflowPolicy> overflow_policy{OverflowPolicy::CountDropped}; //< Поведение при переполнении очереди
+  std::atomic<TimePrecision> time_precision{TimePrecision::Seconds}; //< Точность времени в строках лога
+  std::atomic<int64_t> steady_origin_ns{0}; //< Момент инициализации логгера по steady_clock
+  std::atomic<std::FILE*> output{nullptr}; //< Файл для вывода; nullptr означает stdout
+  std::atomic<size_t> pending_dropped{0}; //< Количество отброшенных сообщений, еще не выведенных в лог
+  std::atomic<size_t> total_dropped{0}; //< Общее количество отброшенных сообщений
+  std::atomic<uint64_t> flush_requested{0}; //< Номер последнего запроса сброса
+  std::atomic<uint64_t> flush_completed{0}; //< Номер последнего выполненного запроса сброса
+  std::atomic<bool> sink_running{false}; //< Флаг работы фонового потока
+  std::atomic<bool> drain_requested{false}; //< Флаг переполнения очереди, требующего немедленного опустошения
+  std::mutex wake_mutex; //< Мьютекс для пробуждения фонового потока
+  std::condition_variable wake_condition; //< Условная переменная для пробуждения фонового потока
+  std::mutex output_mutex; //< Мьютекс, упорядочивающий запись в файл между потоками
+  TimestampCache sync_timestamp_cache; //< Кэш времени синхронного режима; защищен output_mutex
+  std::thread sink_thread; //< Фоновый поток вывода
+
+} // namespace
 
 /**
   * @brief Получение цветной версии строки уровня логирования для последующего вывода в консоль.
   *
   * @param level Уровень логирования.
-  * @return const std::string& Строка уровня логирования.
+  * @return std::string_view Строка уровня логирования в статической памяти.
   * @throw std::logic_error Если передан неизвестный уровень логирования.
   */
-[[nodiscard]] const std::string& LevelAsColoredString(Level level) {
-  switch (level) {
-  case Level::Debug:
-    static const std::string kDebug = STR_COLORED_RGB(30, 200, 145, "[DEBUG]");
-    return kDebug;
-  case Level::Info:
-    static const std::string kInfo = STR_COLORED_RGB(130, 130, 130, "[INFO]");
-    return kInfo;
-  case Level::Warning:
-    static const std::string kWarning = STR_COLORED_RGB(200, 145, 30, "[WARNING]");
-    return kWarning;
-  case Level::Error:
-    static const std::string kError = STR_COLORED_RGB(200, 30, 70, "[ERROR]");
-    return kError;
-  case Level::Fatal:
-    static const std::string kFatal = STR_COLORED_RGB(200, 30, 70, "[FATAL]");
-    return kFatal;
-  default:
+[[nodiscard]] std::string_view LevelAsColoredString(Level level) {
+  static constexpr std::string_view kLevels[] = {
+    STR_COLORED_RGB(30, 200, 145, "[DEBUG]"),
+    STR_COLORED_RGB(130, 130, 130, "[INFO]"),
+    STR_COLORED_RGB(200, 145, 30, "[WARNING]"),
+    STR_COLORED_RGB(200, 30, 70, "[ERROR]"),
+    STR_COLORED_RGB(200, 30, 70, "[FATAL]"),
+  };
+
+  auto index = static_cast<size_t>(level);
+  if (index >= std::size(kLevels)) {
     throw std::logic_error(
       fmt::format("Недопустимый уровень логирования: {}", static_cast<int>(level))
     );
   }
+
+  return kLevels[index];
 }
 
 /**
@@ -86,24 +169,315 @@ namespace gb::Logger {
 }
 
 /**
-  * @brief Структура для инициализации функции вывода логов.
+  * @brief Получение файла для вывода логов.
+  *
+  * @return std::FILE* Установленный файл или stdout.
+  */
+[[nodiscard]] std::FILE* GetOutput() {
+  auto* file = output.load(std::memory_order_acquire);
+  return file ? file : stdout;
+}
+
+/**
+  * @brief Добавление строки лога в конец буфера.
+  *
+  * @param buffer Буфер, в который добавляется строка.
+  * @param cache Кэш строки времени потока записи.
+  * @param timestamp Момент отправки сообщения.
+  * @param level Уровень логирования.
+  * @param message Сообщение.
+  */
+void AppendLine(
+  fmt::memory_buffer& buffer, TimestampCache& cache, const Timestamp& timestamp, Level level,
+  std::string_view message
+) {
+  auto append = [&buffer](std::string_view str) { buffer.append(str.data(), str.data() + str.size()); };
+
+  buffer.push_back('[');
+  append(cache.Get(timestamp.system_ns));
+
+  switch (time_precision.load(std::memory_order_relaxed)) {
+    case TimePrecision::Milliseconds:
+      {
+        auto ms = static_cast<int>(timestamp.system_ns / 1'000'000 % 1000);
+        char tail[] = {'.', static_cast<char>('0' + ms / 100), static_cast<char>('0' + ms / 10 % 10), static_cast<char>('0' + ms % 10)};
+        append(std::string_view(tail, sizeof(tail)));
+      }
+      break;
+    case TimePrecision::MonotonicTicks:
+      {
+        auto ticks = (timestamp.steady_ns - steady_origin_ns.load(std::memory_order_relaxed)) / 1000;
+        fmt::format_to(std::back_inserter(buffer), " +{}us", ticks);
+      }
+      break;
+    case TimePrecision::Seconds:
+    default:
+      break;
+  }
+
+  append("] ");
+  append(LevelAsColoredString(level));
+  buffer.push_back(' ');
+  append(message);
+  buffer.push_back('\n');
+}
+
+/**
+  * @brief Запись буфера в файл одним вызовом с последующей очисткой буфера.
+  *
+  * @param buffer Записываемый буфер.
+  * @note Вызывающий должен удерживать output_mutex.
+  */
+void WriteBufferLocked(fmt::memory_buffer& buffer) {
+  if (buffer.size() == 0) {
+    return;
+  }
+
+  auto* file = GetOutput();
+  std::fwrite(buffer.data(), 1, buffer.size(), file);
+  std::fflush(file);
+  buffer.clear();
+}
+
+/**
+  * @brief Запись буфера в файл с захватом мьютекса вывода.
+  *
+  * @param buffer Записываемый буфер.
+  */
+void WriteBuffer(fmt::memory_buffer& buffer) {
+  std::lock_guard lock(output_mutex);
+  WriteBufferLocked(buffer);
+}
+
+/**
+  * @brief Получение текущего момента по steady_clock в наносекундах.
+  */
+[[nodiscard]] int64_t SteadyNow() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()
+  ).count();
+}
+
+/**
+  * @brief Получение текущего момента времени.
+  */
+[[nodiscard]] Timestamp Now() {
+  Timestamp timestamp;
+  timestamp.system_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::system_clock::now().time_since_epoch()
+  ).count();
+  timestamp.steady_ns = time_precision.load(std::memory_order_relaxed) == TimePrecision::MonotonicTicks
+    ? SteadyNow()
+    : 0;
+  return timestamp;
+}
+
+/**
+  * @brief Основной цикл фонового потока вывода.
+  *
+  * Сообщения накапливаются в пакет и записываются при запросе сброса, переполнении пакета,
+  * либо если пакет удерживается дольше kMaxFlushInterval.
+  */
+void SinkLoop() {
+  fmt::memory_buffer batch;
+  TimestampCache timestamp_cache;
+  auto served = flush_completed.load(std::memory_order_relaxed);
+  auto last_write = std::chrono::steady_clock::now();
+
+  for (;;) {
+    // Номер запроса читается до опустошения очереди, чтобы сброс охватил все сообщения,
+    // отправленные до вызова Flush.
+    auto requested = flush_requested.load(std::memory_order_acquire);
+    auto stopping = !sink_running.load(std::memory_order_acquire);
+
+    while (queue.TryPop([&batch, &timestamp_cache](const Record& record) {
+      AppendLine(batch, timestamp_cache, record.timestamp, record.level, std::string_view(record.text, record.size));
+    })) {
+      if (batch.size() >= kBatchSize) {
+        WriteBuffer(batch);
+        last_write = std::chrono::steady_clock::now();
+      }
+    }
+
+    if (auto dropped = pending_dropped.exchange(0, std::memory_order_relaxed)) {
+      AppendLine(
+        batch, timestamp_cache, Now(), Level::Warning, fmt::format("Отброшено сообщений лога: {}", dropped)
+      );
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (requested != served || stopping || now - last_write >= kMaxFlushInterval) {
+      WriteBuffer(batch);
+      last_write = now;
+
+      if (requested != served) {
+        served = requested;
+        flush_completed.store(served, std::memory_order_release);
+        flush_completed.notify_all();
+      }
+    }
+
+    if (stopping) {
+      break;
+    }
+
+    std::unique_lock lock(wake_mutex);
+    wake_condition.wait_for(lock, kWakeInterval, [served] {
+      return flush_requested.load(std::memory_order_acquire) != served
+        || drain_requested.exchange(false, std::memory_order_acq_rel)
+        || !sink_running.load(std::memory_order_acquire);
+    });
+  }
+}
+
+/**
+  * @brief Запросить сброс у фонового потока.
+  *
+  * @return uint64_t Номер запроса сброса.
+  */
+uint64_t RequestFlush() {
+  uint64_t ticket;
+  {
+    std::lock_guard lock(wake_mutex);
+    ticket = flush_requested.fetch_add(1, std::memory_order_acq_rel) + 1;
+  }
+  wake_condition.notify_one();
+  return ticket;
+}
+
+void SetMode(Mode new_mode) {
+  if (new_mode == Mode::Sync) {
+    FlushAndWait();
+  }
+
+  mode.store(new_mode, std::memory_order_release);
+}
+
+Mode GetMode() {
+  return mode.load(std::memory_order_acquire);
+}
+
+void SetOverflowPolicy(OverflowPolicy policy) {
+  overflow_policy.store(policy, std::memory_order_relaxed);
+}
+
+void SetTimePrecision(TimePrecision precision) {
+  time_precision.store(precision, std::memory_order_relaxed);
+}
+
+void SetOutput(std::FILE* file) {
+  FlushAndWait();
+
+  std::lock_guard lock(output_mutex);
+  output.store(file, std::memory_order_release);
+}
+
+size_t GetDroppedCount() {
+  return total_dropped.load(std::memory_order_relaxed);
+}
+
+void Flush() {
+  if (sink_running.load(std::memory_order_acquire)) {
+    RequestFlush();
+  }
+}
+
+void FlushAndWait() {
+  if (!sink_running.load(std::memory_order_acquire)) {
+    std::lock_guard lock(output_mutex);
+    std::fflush(GetOutput());
+    return;
+  }
+
+  auto ticket = RequestFlush();
+  auto completed = flush_completed.load(std::memory_order_acquire);
+
+  while (completed < ticket) {
+    flush_completed.wait(completed, std::memory_order_acquire);
+    completed = flush_completed.load(std::memory_order_acquire);
+  }
+}
+
+void Submit(Level level, std::string_view message) {
+  auto timestamp = Now();
+
+  if (mode.load(std::memory_order_acquire) == Mode::Sync || !sink_running.load(std::memory_order_acquire)) {
+    fmt::memory_buffer line;
+    std::lock_guard lock(output_mutex);
+    AppendLine(line, sync_timestamp_cache, timestamp, level, message);
+    WriteBufferLocked(line);
+    return;
+  }
+
+  auto fill = [timestamp, level, message](Record& record) {
+    auto size = message.size();
+    std::memcpy(record.text, message.data(), std::min(size, sizeof(record.text)));
+
+    // Длинное сообщение обрезается по границе символа UTF-8 и помечается многоточием.
+    if (size > sizeof(record.text)) {
+      size = sizeof(record.text) - kTruncationMarker.size();
+      while (size > 0 && (static_cast<unsigned char>(message[size]) & 0xC0) == 0x80) {
+        size--;
+      }
+
+      std::memcpy(record.text + size, kTruncationMarker.data(), kTruncationMarker.size());
+      size += kTruncationMarker.size();
+    }
+
+    record.timestamp = timestamp;
+    record.level = level;
+    record.size = static_cast<uint16_t>(size);
+  };
+
+  while (!queue.TryPush(fill)) {
+    drain_requested.store(true, std::memory_order_release);
+    wake_condition.notify_one();
+
+    auto policy = overflow_policy.load(std::memory_order_relaxed);
+    if (policy == OverflowPolicy::Block || level == Level::Fatal) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    total_dropped.fetch_add(1, std::memory_order_relaxed);
+    if (policy == OverflowPolicy::CountDropped) {
+      pending_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    return;
+  }
+
+  if (level == Level::Fatal) {
+    FlushAndWait();
+  }
+}
+
+/**
+  * @brief Структура для инициализации функции вывода логов и фонового потока.
   */
 struct LoggerInitializer final {
 public:
   LoggerInitializer() {
     SDL_LogSetOutputFunction(Output, nullptr);
+
+    steady_origin_ns.store(SteadyNow(), std::memory_order_relaxed);
+    sink_running.store(true, std::memory_order_release);
+    sink_thread = std::thread(SinkLoop);
   }
 
   ~LoggerInitializer() {
     SDL_LogSetOutputFunction(nullptr, nullptr);
+
+    {
+      std::lock_guard lock(wake_mutex);
+      sink_running.store(false, std::memory_order_release);
+    }
+    wake_condition.notify_one();
+    sink_thread.join();
   }
 
 private:
   static void Output(void*, int, SDL_LogPriority priority, const char * message) {
-    auto time_str = GetFormattedTime();
-    auto level_str = LevelAsColoredString(SDLLogPriorityToLogLevel(priority));
-
-    fmt::println("[{}] {} {}", time_str.c_str(), level_str.c_str(), message);
+    Submit(SDLLogPriorityToLogLevel(priority), message);
   }
 } _;
 
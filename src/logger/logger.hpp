@@ -1,14 +1,25 @@
 #ifndef GUIDING_BREEZE_SRC_LOGGER_LOGGER_H
 #define GUIDING_BREEZE_SRC_LOGGER_LOGGER_H
 
-#include <stdexcept>
-#include <string>
+#include <cstdio>
+#include <iterator>
+#include <string_view>
+#include <utility>
 
-#include "SDL_log.h"
 #include "fmt/base.h"
 #include "fmt/format.h"
 #include "sys/types.h"
 
+// Минимальный уровень логирования, сообщения ниже которого удаляются при компиляции.
+// По умолчанию в релизной сборке (NDEBUG) отбрасываются сообщения уровня DEBUG.
+#ifndef GB_LOGGER_MIN_LEVEL
+  #ifdef NDEBUG
+    #define GB_LOGGER_MIN_LEVEL 1
+  #else
+    #define GB_LOGGER_MIN_LEVEL 0
+  #endif
+#endif
+
 namespace gb::Logger {
 
 /**
@@ -22,39 +33,121 @@ enum class Level : u_short {
   Fatal    //< Критические ошибки, прерывающие выполнение программы
 };
 
+/**
+ * @brief Минимальный уровень логирования, доступный в текущей сборке.
+ */
+inline constexpr Level kMinLevel = static_cast<Level>(GB_LOGGER_MIN_LEVEL);
+
+/**
+ * @brief Режим вывода логов.
+ */
+enum class Mode : u_short {
+  Sync,  //< Сообщение выводится в потоке вызывающего
+  Async  //< Сообщение передается фоновому потоку через кольцевой буфер
+};
+
+/**
+ * @brief Поведение при переполнении очереди асинхронного вывода.
+ */
+enum class OverflowPolicy : u_short {
+  Drop,        //< Сообщение молча отбрасывается
+  Block,       //< Вызывающий поток ждет освобождения места в очереди
+  CountDropped //< Сообщение отбрасывается, а их количество выводится при следующем сбросе
+};
+
+/**
+ * @brief Точность времени в строках лога.
+ */
+enum class TimePrecision : u_short {
+  Seconds,       //< "HH:MM:SS"
+  Milliseconds,  //< "HH:MM:SS.mmm"
+  MonotonicTicks //< "HH:MM:SS +<мкс>", где мкс отсчитываются от инициализации логгера по steady_clock
+};
+
+/**
+ * @brief Установить режим вывода логов.
+ *
+ * @param mode Режим вывода.
+ * @note При переключении в синхронный режим очередь предварительно сбрасывается.
+ */
+void SetMode(Mode mode);
+
+/**
+ * @brief Получить текущий режим вывода логов.
+ *
+ * @return Mode Режим вывода.
+ */
+[[nodiscard]] Mode GetMode();
+
+/**
+ * @brief Установить поведение при переполнении очереди асинхронного вывода.
+ *
+ * @param policy Поведение при переполнении.
+ * @note Сообщения уровня FATAL никогда не отбрасываются.
+ */
+void SetOverflowPolicy(OverflowPolicy policy);
+
+/**
+ * @brief Установить точность времени в строках лога.
+ *
+ * @param precision Точность времени.
+ */
+void SetTimePrecision(TimePrecision precision);
+
+/**
+ * @brief Установить файл для вывода логов.
+ *
+ * @param file Файл для вывода; nullptr означает stdout.
+ */
+void SetOutput(std::FILE* file);
+
+/**
+ * @brief Получить общее количество отброшенных из-за переполнения сообщений.
+ *
+ * @return size_t Количество отброшенных сообщений.
+ */
+[[nodiscard]] size_t GetDroppedCount();
+
+/**
+ * @brief Запросить запись накопленных сообщений, не дожидаясь ее завершения.
+ *
+ * @note Вызывается один раз за кадр.
+ */
+void Flush();
+
+/**
+ * @brief Записать все ранее отправленные сообщения и дождаться завершения записи.
+ */
+void FlushAndWait();
+
+/**
+ * @brief Передать готовое сообщение на вывод.
+ *
+ * @param level Уровень логирования.
+ * @param message Отформатированное сообщение.
+ * @note Сообщения длиннее внутреннего ограничения записи обрезаются по границе символа UTF-8
+ * и помечаются многоточием.
+ */
+void Submit(Level level, std::string_view message);
+
 /**
  * @brief Функция для вывода логов.
  * 
- * @param level Уровень логирования.
- * @param fmt Сообщение для вывода.
+ * @param fmt Сообщение для вывода; проверяется и разбирается при компиляции.
  * @param args Аргументы для форматирования сообщения.
- * @throw std::logic_error Если передан недопустимый уровень логирования.
+ * @note Сообщение форматируется в буфер на стеке без обращений к куче,
+ * а вызовы с уровнем ниже kMinLevel не генерируют кода.
  */
 template<Level Level, typename... Args>
-void Log(const std::string& fmt, Args&&... args) {
-  auto msg = fmt::format(fmt::runtime(fmt), args...);
+void Log(fmt::format_string<Args...> fmt, Args&&... args) {
+  static_assert(Level <= Level::Fatal, "Нереализованный уровень логирования");
 
-  if constexpr (Level == Level::Debug) {
-    SDL_LogDebug(SDL_LOG_CATEGORY_APPLICATION, "%s", msg.c_str());
+  if constexpr (Level >= kMinLevel) {
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer), fmt, std::forward<Args>(args)...);
+    Submit(Level, std::string_view(buffer.data(), buffer.size()));
   }
-  else if constexpr (Level == Level::Info) {
-    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s", msg.c_str());
-  }
-  else if constexpr (Level == Level::Warning) {
-    SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "%s", msg.c_str());
-  }
-  else if constexpr (Level == Level::Error) {
-    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s", msg.c_str());
-  }
-  else if constexpr (Level == Level::Fatal) {
-    SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "%s", msg.c_str());
-  }
-  else {
-    throw std::logic_error(
-      fmt::format("Нереализованный уровень логирования: {}", static_cast<u_short>(Level))
-    );
-  }
- }
+}
 
 /**
  * @brief Функция для вывода логов на уровне DEBUG.
@@ -63,8 +156,8 @@ void Log(const std::string& fmt, Args&&... args) {
  * @param args Аргументы для форматирования сообщения.
  */
 template<typename... Args>
-inline void Debug(const std::string& fmt, Args&&... args) {
-  Log<Level::Debug>(fmt, args...);
+inline void Debug(fmt::format_string<Args...> fmt, Args&&... args) {
+  Log<Level::Debug, Args...>(fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -74,8 +167,8 @@ inline void Debug(const std::string& fmt, Args&&... args) {
  * @param args Аргументы для форматирования сообщения.
  */
 template<typename... Args>
-inline void Info(const std::string& fmt, Args&&... args) {
-  Log<Level::Info>(fmt, args...);
+inline void Info(fmt::format_string<Args...> fmt, Args&&... args) {
+  Log<Level::Info, Args...>(fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -85,8 +178,8 @@ inline void Info(const std::string& fmt, Args&&... args) {
  * @param args Аргументы для форматирования сообщения.
  */
 template<typename... Args>
-inline void Warn(const std::string& fmt, Args&&... args) {
-  Log<Level::Warning>(fmt, args...);
+inline void Warn(fmt::format_string<Args...> fmt, Args&&... args) {
+  Log<Level::Warning, Args...>(fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -96,8 +189,8 @@ inline void Warn(const std::string& fmt, Args&&... args) {
  * @param args Аргументы для форматирования сообщения.
  */
 template<typename... Args>
-inline void Error(const std::string& fmt, Args&&... args) {
-  Log<Level::Error>(fmt, args...);
+inline void Error(fmt::format_string<Args...> fmt, Args&&... args) {
+  Log<Level::Error, Args...>(fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -107,8 +200,8 @@ inline void Error(const std::string& fmt, Args&&... args) {
  * @param args Аргументы для форматирования сообщения.
  */
 template<typename... Args>
-inline void Fatal(const std::string& fmt, Args&&... args) {
-  Log<Level::Fatal>(fmt, args...);
+inline void Fatal(fmt::format_string<Args...> fmt, Args&&... args) {
+  Log<Level::Fatal, Args...>(fmt, std::forward<Args>(args)...);
 }
 
 } // namespace gb::Logger
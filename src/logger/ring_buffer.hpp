@@ -0,0 +1,113 @@
+#ifndef GUIDING_BREEZE_SRC_LOGGER_RING_BUFFER_H
+#define GUIDING_BREEZE_SRC_LOGGER_RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace gb::Logger {
+
+/**
+ * @brief Ограниченный кольцевой буфер без блокировок для нескольких писателей и одного читателя.
+ *
+ * Каждая ячейка хранит собственный счетчик последовательности, поэтому писатели
+ * конкурируют только за позицию записи, а читатель вовсе не использует атомарные RMW операции.
+ *
+ * @tparam T Тип хранимых элементов.
+ * @tparam Capacity Вместимость буфера; должна быть степенью двойки.
+ */
+template<typename T, size_t Capacity>
+class RingBuffer final {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Вместимость должна быть степенью двойки");
+
+private:
+  static constexpr size_t kMask = Capacity - 1;
+  static constexpr size_t kCacheLineSize = 64;
+
+  struct alignas(kCacheLineSize) Cell {
+    std::atomic<size_t> sequence; //< Номер операции, которая может занять ячейку следующей
+    T value;                      //< Хранимое значение
+  };
+
+private:
+  std::unique_ptr<Cell[]> cells_;
+  alignas(kCacheLineSize) std::atomic<size_t> enqueue_pos_{0}; //< Позиция записи; разделяется писателями
+  alignas(kCacheLineSize) size_t dequeue_pos_{0};              //< Позиция чтения; принадлежит читателю
+
+public:
+  RingBuffer() : cells_(std::make_unique<Cell[]>(Capacity)) {
+    for (auto i = size_t{0}; i < Capacity; i++) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  RingBuffer(const RingBuffer&) = delete;
+  RingBuffer(RingBuffer&&) = delete;
+  ~RingBuffer() noexcept = default;
+
+public:
+  RingBuffer& operator=(const RingBuffer&) = delete;
+  RingBuffer& operator=(RingBuffer&&) = delete;
+
+public:
+  /**
+   * @brief Попытаться занять ячейку и заполнить ее.
+   *
+   * @param fill Функция вида void(T&), заполняющая занятую ячейку.
+   * @return true Если элемент добавлен.
+   * @return false Если буфер заполнен.
+   * @note Потокобезопасно для любого числа писателей.
+   */
+  template<typename Fill>
+  bool TryPush(Fill&& fill) {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+    for (;;) {
+      auto& cell = cells_[pos & kMask];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          fill(cell.value);
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0) {
+        return false;
+      }
+      else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief Попытаться извлечь следующий элемент.
+   *
+   * @param consume Функция вида void(const T&), обрабатывающая элемент до освобождения ячейки.
+   * @return true Если элемент обработан.
+   * @return false Если буфер пуст.
+   * @note Может вызываться только из одного потока-читателя.
+   */
+  template<typename Consume>
+  bool TryPop(Consume&& consume) {
+    auto& cell = cells_[dequeue_pos_ & kMask];
+    auto sequence = cell.sequence.load(std::memory_order_acquire);
+
+    if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(dequeue_pos_ + 1) < 0) {
+      return false;
+    }
+
+    consume(static_cast<const T&>(cell.value));
+    cell.sequence.store(dequeue_pos_ + Capacity, std::memory_order_release);
+    dequeue_pos_++;
+    return true;
+  }
+};
+
+} // namespace gb::Logger
+
+#endif // GUIDING_BREEZE_SRC_LOGGER_RING_BUFFER_H
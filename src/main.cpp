@@ -1,6 +1,20 @@
+#include "core/assets/assets.hpp"
+#include "core/events/game_events.hpp"
+#include "core/game.hpp"
+#include "core/input/input.hpp"
+#include "core/memory/frame_memory.hpp"
+#include "core/render/render_list.hpp"
+#include "core/render/render_submit.hpp"
+#include "core/screen.hpp"
 #include "logger/logger.hpp"
+#include "profiler/profiler.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
 
 #include "SDL.h"
 #include "SDL_events.h"
@@ -15,13 +29,110 @@ extern bool IsExitRequested(); //< Функция проверки запрос
 extern void RequestExit(); //< Функция запроса на завершения игры
 
 extern void OnStart(SDL_Window* window, SDL_Renderer* renderer); //< Функция начала игры; Вызывается лишь раз при удачном запуске программы
-extern void Update(); //< Зацикленная функция обновления логики игры
-extern void Render(); //< Зацикленная функция отрисовки игры
+extern void Update(float delta); //< Функция обновления логики игры; вызывается с фиксированным шагом delta (сек.)
+extern void Extract(RenderList& list, float alpha); //< Функция записи мира в список команд отрисовки; вызывается после тиков кадра
+extern void Render(float alpha); //< Функция отрисовки интерфейса игры; alpha - доля прошедшего времени до следующего тика
 extern void OnExit(); //< Функция завершения игры; Вызывается лишь раз перед выходом из программы
 
 } // namespace gb
 
-int main(int, char**) {
+namespace {
+
+/**
+ * @brief Добавить загруженный шрифт в атлас ImGui и сделать его основным.
+ *
+ * @param data Содержимое файла шрифта.
+ * @note Вызывается вне кадра ImGui; текстура шрифтов пересоздается в следующем NewFrame.
+ */
+void InstallFont(const std::vector<std::byte>& data) {
+  auto& io = ImGui::GetIO();
+
+  // Атлас ImGui освобождает переданные данные сам, поэтому ресурс можно сразу отпустить.
+  auto* font_data = IM_ALLOC(data.size());
+  std::memcpy(font_data, data.data(), data.size());
+
+  io.FontDefault = io.Fonts->AddFontFromMemoryTTF(font_data, static_cast<int>(data.size()), 16.0F, nullptr, io.Fonts->GetGlyphRangesCyrillic());
+  ImGui_ImplSDLRenderer2_DestroyFontsTexture();
+}
+
+/**
+ * @brief Получить значение параметра командной строки вида "--name value".
+ *
+ * @return const char* Значение или nullptr, если параметр не передан.
+ */
+const char* FindArgument(int argc, char** argv, std::string_view name) {
+  for (auto i = 1; i + 1 < argc; i++) {
+    if (argv[i] == name) {
+      return argv[i + 1];
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Симулировать кадр: выполнить тики логики за прошедшее время и записать мир в список команд.
+ *
+ * @param frame_seconds Время, прошедшее с прошлого кадра.
+ * @param list Список команд кадра.
+ * @param width Ширина области вывода.
+ * @param height Высота области вывода.
+ * @note Выполняется в потоке конвейера кадра (gb::FramePipeline) или сразу в главном потоке.
+ */
+void Simulate(double frame_seconds, gb::RenderList& list, int width, int height) {
+  auto& timestep = gb::Game::GetTimestep();
+
+  {
+    GB_PROFILE_ZONE("Обновление");
+
+    auto ticks = timestep.Advance(frame_seconds);
+    for (auto i = uint32_t{0}; i < ticks; i++) {
+      GB_PROFILE_ZONE("Тик");
+      gb::Update(timestep.GetTickDuration());
+    }
+
+    if (gb::Input::IsReplayFinished()) {
+      gb::Logger::Info("Воспроизведение записи ввода завершено.");
+      gb::Input::StopReplay();
+    }
+  }
+
+  {
+    GB_PROFILE_ZONE("Извлечение отрисовки");
+
+    list.Reset(width, height);
+    gb::Extract(list, timestep.GetAlpha());
+  }
+}
+
+/**
+ * @brief Проверить, перехвачено ли событие интерфейсом и не должно попадать в ввод логики.
+ *
+ * @note Отпускание клавиш и кнопок не перехватывается, чтобы они не оставались нажатыми для логики.
+ */
+bool IsCapturedByInterface(const SDL_Event& event) {
+  const auto& io = ImGui::GetIO();
+  switch (event.type) {
+    case SDL_KEYDOWN:
+      return io.WantCaptureKeyboard;
+    case SDL_MOUSEMOTION:
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEWHEEL:
+      return io.WantCaptureMouse;
+    default:
+      return false;
+  }
+}
+
+} // namespace
+
+/**
+ * Параметры:
+ *   --record PATH  Записать ввод сеанса для воспроизведения в guiding_breeze_bench; начальный мир
+ *                  сохраняется рядом с записью в PATH.gbs.
+ *   --replay PATH  Воспроизвести записанный ввод вместо ввода с клавиатуры и мыши.
+ *   --ui-rate N    Кэшировать интерфейс и без ввода перестраивать его N раз в секунду.
+ */
+int main(int argc, char** argv) {
   gb::Logger::Info("Подготовка перед запуском игры.");
 
   if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
@@ -35,7 +146,8 @@ int main(int, char**) {
     return EXIT_FAILURE;
   }
 
-  auto* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_ACCELERATED);
+  // Вертикальную синхронизацию включает и выключает режим темпа кадров (gb::FramePacer)
+  auto* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
   if (!renderer) {
     gb::Logger::Fatal("Не удалось инициализировать средство визуализации...");
     SDL_DestroyWindow(window);
@@ -54,49 +166,182 @@ int main(int, char**) {
   ImGui_ImplSDL2_InitForSDLRenderer(window, renderer);
   ImGui_ImplSDLRenderer2_Init(renderer);
 
-  // Убираем сохранение данных ImGui и добавляем шрифт
+  // Убираем сохранение данных ImGui
   auto& io = ImGui::GetIO();
   io.IniFilename = nullptr;
-  io.Fonts->AddFontFromFileTTF("res/fonts/minecraft_seven.ttf", 16.0F, nullptr, io.Fonts->GetGlyphRangesCyrillic());
+
+  // Ресурсы загружаются в фоне; до загрузки шрифта ImGui использует встроенный
+  gb::Assets::Initialize(renderer);
+  auto font = gb::Assets::LoadFile("res/fonts/minecraft_seven.ttf");
 
   gb::OnStart(window, renderer);
 
+  auto& timestep = gb::Game::GetTimestep();
+  auto& frame_pacer = gb::Game::GetFramePacer();
+  auto& frame_pipeline = gb::Game::GetFramePipeline();
+  auto& interface_cache = gb::Game::GetInterfaceCache();
+  auto& text_renderer = gb::Game::GetTextRenderer();
+  auto& event_bus = gb::Game::GetEventBus();
+
+  // Запись начинается со снимка мира и заново засеянного генератора, поэтому воспроизведение
+  // стартует с того же состояния логики
+  if (const auto* replay_path = FindArgument(argc, argv, "--replay"); replay_path && gb::Input::StartReplay(replay_path)) {
+    if (const auto& world_path = gb::Input::GetReplayWorld(); !world_path.empty() && !gb::Game::LoadWorld(world_path)) {
+      gb::Logger::Warn("Начальный мир записи не загружен; воспроизведение может разойтись с записью.");
+    }
+    gb::Game::SetSeed(gb::Input::GetReplaySeed());
+    timestep.SetTickRate(gb::Input::GetReplayTickRate());
+  } else if (const auto* record_path = FindArgument(argc, argv, "--record")) {
+    auto world_path = std::string(record_path) + ".gbs";
+    if (!gb::Game::SaveWorld(world_path)) {
+      world_path.clear();
+    }
+    gb::Game::SetSeed(gb::Game::GetSeed());
+    gb::Input::StartRecording(record_path, gb::Game::GetSeed(), timestep.GetTickRate(), world_path);
+  }
+
+  if (const auto* ui_rate = FindArgument(argc, argv, "--ui-rate")) {
+    interface_cache.SetRebuildRate(static_cast<uint32_t>(std::max(0L, std::strtol(ui_rate, nullptr, 10))));
+    interface_cache.SetEnabled(true);
+  }
+
+  auto counter_frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+  auto previous_counter = SDL_GetPerformanceCounter();
+
+  // Списки команд двойной буферизации: пока главный поток выводит один, поток симуляции заполняет другой
+  std::array<gb::RenderList, 2> render_lists;
+  auto front = size_t{0}; //< Индекс списка, выводимого в текущем кадре
+
   // Основной цикл
   while (!gb::IsExitRequested()) {
+    gb::FrameMemory::BeginFrame();
+    gb::Profiler::BeginFrame();
+
+    auto counter = SDL_GetPerformanceCounter();
+    auto frame_seconds = (counter - previous_counter) / counter_frequency;
+    previous_counter = counter;
 
     // Обработка событий SDL
-    SDL_Event event;
-    while (SDL_PollEvent(&event)) {
-      ImGui_ImplSDL2_ProcessEvent(&event); 
-      switch (event.type) {
-        case SDL_EventType::SDL_QUIT:
-          gb::RequestExit();
-          break;
-        default:
-          break;
+    {
+      GB_PROFILE_ZONE("События");
+
+      SDL_Event event;
+      while (SDL_PollEvent(&event)) {
+        ImGui_ImplSDL2_ProcessEvent(&event);
+        frame_pacer.HandleEvent(event);
+        interface_cache.HandleEvent(event);
+        if (!IsCapturedByInterface(event)) {
+          gb::Input::Push(event);
+        }
+
+        gb::Events::Translate(event_bus, event);
+      }
+
+      event_bus.Dispatch();
+    }
+
+    // Глубина читается один раз: интерфейс кадра может ее сменить, но применится она со следующего кадра
+    auto depth = frame_pipeline.GetDepth();
+    int output_width = 0;
+    int output_height = 0;
+    SDL_GetRendererOutputSize(renderer, &output_width, &output_height);
+
+    // Без конвейера кадр симулируется сразу, и выводится его же список команд
+    if (depth == 0) {
+      frame_pipeline.Run([&list = render_lists[front], frame_seconds, output_width, output_height] {
+        Simulate(frame_seconds, list, output_width, output_height);
+      });
+    }
+
+    // Прием загруженных в фоне ресурсов
+    gb::Assets::Update();
+
+    if (font.IsValid() && font.GetState() != gb::Assets::State::Loading) {
+      if (const auto* data = font.GetData()) {
+        InstallFont(*data);
+        interface_cache.Invalidate();
       }
+      font.Reset();
+    }
+
+    // Атлас надписей запекается в пуле потоков, а в текстуру выгружается здесь
+    text_renderer.Update(renderer);
+
+    // Построение интерфейса; он читает и меняет логику, поэтому строится, пока симуляция не идет.
+    // С кэшем интерфейса кадр ImGui без ввода и изменений пропускается, а выводится прошлый интерфейс.
+    if (interface_cache.BeginFrame()) {
+      GB_PROFILE_ZONE("Интерфейс");
+
+      ImGui_ImplSDLRenderer2_NewFrame();
+      ImGui_ImplSDL2_NewFrame();
+      ImGui::NewFrame();
+      gb::Render(timestep.GetAlpha());
+      ImGui::Render();
     }
 
-    // Обновление логики игры
-    gb::Update();
+    // С конвейером следующий кадр симулируется в другой список, пока этот выводится и ждет синхронизации
+    if (depth > 0) {
+      frame_pipeline.Run([&list = render_lists[front ^ 1], frame_seconds, output_width, output_height] {
+        Simulate(frame_seconds, list, output_width, output_height);
+      });
+    }
 
-    // Начало кадра отрисовки
-    ImGui_ImplSDLRenderer2_NewFrame();
-    ImGui_ImplSDL2_NewFrame();
-    ImGui::NewFrame();
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderClear(renderer);
+    // Отрисовка кадра: до Wait главный поток обращается только к списку команд и данным ImGui
+    {
+      GB_PROFILE_ZONE("Отрисовка");
+
+      gb::RenderSubmit::Submit(renderer, render_lists[front]);
+      interface_cache.Draw(ImGui::GetDrawData());
+    }
+
+    {
+      GB_PROFILE_ZONE("Вывод кадра");
+      SDL_RenderPresent(renderer);
+    }
+
+    {
+      GB_PROFILE_ZONE("Ожидание кадра");
+      frame_pacer.EndFrame();
+    }
+
+    // Запись накопленных за кадр логов
+    gb::Logger::Flush();
+
+    // Симуляция следующего кадра завершается до всего, что обращается к логике
+    {
+      GB_PROFILE_ZONE("Ожидание симуляции");
+      frame_pipeline.Wait();
+    }
+
+    if (depth > 0) {
+      front ^= 1;
+    }
+
+    // Смена режима экрана применяется между кадрами; ее время не засчитывается логике, чтобы не догонять тики
+    if (gb::Screen::Update()) {
+      previous_counter = SDL_GetPerformanceCounter();
+      frame_pacer.Restart();
+      interface_cache.Invalidate();
+    } else {
+      // Окно могло перейти на дисплей с другой частотой обновления и без смены режима экрана
+      frame_pacer.Update();
+    }
+
+    // Перезагрузка модуля систем тоже выполняется между кадрами, пока ни одна система не работает
+    if (gb::Game::GetSystemPlugin().Update()) {
+      previous_counter = SDL_GetPerformanceCounter();
+      interface_cache.Invalidate();
+    }
 
-    // Отрисовка кадра
-    gb::Render();
-    ImGui::Render();
-    ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData(), renderer);
-    SDL_RenderPresent(renderer);
+    gb::Profiler::EndFrame();
   }
 
+  gb::Input::StopRecording();
   gb::OnExit();
 
   // Очистка ресурсов
+  font.Reset();
+  gb::Assets::Shutdown();
   ImGui_ImplSDLRenderer2_Shutdown();
   ImGui_ImplSDL2_Shutdown();
   ImGui::DestroyContext();
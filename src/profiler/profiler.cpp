@@ -0,0 +1,410 @@
+#include "profiler.hpp"
+
+#include "logger/logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "SDL_timer.h"
+#include "fmt/format.h"
+#include "imgui.h"
+
+namespace gb::Profiler {
+
+namespace {
+
+  constexpr size_t kZoneCapacity = 16384; //< Вместимость кольцевого буфера зон одного потока
+  constexpr size_t kMaxDepth = 64; //< Максимальная вложенность зон
+  constexpr size_t kHistoryFrames = 240; //< Количество кадров в скользящей статистике
+  constexpr size_t kTraceCapacity = 200'000; //< Количество зон, хранимых для экспорта
+
+  /**
+   * @brief Завершенная зона.
+   */
+  struct Zone {
+    const char* name; //< Имя зоны
+    uint64_t begin;   //< Значение счетчика в начале зоны
+    uint64_t end;     //< Значение счетчика в конце зоны
+    uint32_t thread;  //< Индекс потока
+    uint32_t depth;   //< Глубина вложенности
+  };
+
+  /**
+   * @brief Ячейка кольцевого буфера зон.
+   *
+   * Главный поток может читать ячейку, пока поток-владелец, обогнав его на круг, пишет в нее
+   * новую зону. Номер записи позволяет заметить это и отбросить прочитанную копию.
+   */
+  struct ZoneSlot {
+    std::atomic<uint64_t> sequence{0}; //< Номер записанной зоны плюс один; ноль, пока зона пишется
+    Zone zone;                         //< Зона
+  };
+
+  /**
+   * @brief Буфер зон одного потока. Пишет только поток-владелец, читает только главный поток.
+   */
+  struct ThreadBuffer {
+    struct OpenZone {
+      const char* name;
+      uint64_t begin;
+    };
+
+    uint32_t index;                             //< Индекс потока
+    std::array<ZoneSlot, kZoneCapacity> zones;  //< Кольцевой буфер завершенных зон
+    std::atomic<uint64_t> write_index{0};       //< Количество записанных зон
+    uint64_t read_index{0};                     //< Количество прочитанных главным потоком зон
+    std::array<OpenZone, kMaxDepth> stack;      //< Стек начатых зон
+    uint32_t depth{0};                          //< Текущая глубина стека
+  };
+
+  /**
+   * @brief Скользящая статистика зоны по кадрам.
+   */
+  struct ZoneStats {
+    std::array<float, kHistoryFrames> samples{}; //< Суммарное время зоны за кадр, мс
+    size_t count{0};                             //< Количество записанных кадров
+    float frame_total{0.0F};                     //< Накопленное время в текущем кадре, мс
+    bool seen{false};                            //< Была ли зона в текущем кадре
+  };
+
+  std::atomic<bool> enabled{true}; //< Флаг записи зон
+  std::mutex buffers_mutex; //< Мьютекс списка буферов потоков
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers; //< Буферы всех потоков, когда-либо писавших зоны
+  thread_local ThreadBuffer* thread_buffer{nullptr}; //< Буфер текущего потока
+
+  std::mutex intern_mutex; //< Мьютекс хранилища строк
+  std::unordered_set<std::string> interned; //< Хранилище строк со временем жизни программы
+
+  // Данные ниже используются только главным потоком.
+  uint64_t frame_begin{0}; //< Начало текущего кадра
+  uint64_t last_frame_begin{0}; //< Начало последнего завершенного кадра
+  uint64_t last_frame_end{0}; //< Конец последнего завершенного кадра
+  uint64_t origin{0}; //< Значение счетчика при первом кадре; начало отсчета для экспорта
+  std::vector<Zone> frame_zones; //< Зоны, завершенные в текущем кадре
+  std::vector<Zone> last_frame_zones; //< Зоны последнего завершенного кадра
+  std::deque<Zone> trace; //< Зоны для экспорта
+  std::unordered_map<std::string_view, ZoneStats> stats; //< Статистика по именам зон
+  std::array<float, kHistoryFrames> frame_times{}; //< Длительность кадров, мс
+  size_t frame_count{0}; //< Количество завершенных кадров
+
+  /**
+   * @brief Получить буфер текущего потока, при необходимости зарегистрировав его.
+   */
+  ThreadBuffer& GetThreadBuffer() {
+    if (!thread_buffer) {
+      std::lock_guard lock(buffers_mutex);
+      auto& buffer = buffers.emplace_back(std::make_unique<ThreadBuffer>());
+      buffer->index = static_cast<uint32_t>(buffers.size() - 1);
+      thread_buffer = buffer.get();
+    }
+
+    return *thread_buffer;
+  }
+
+  /**
+   * @brief Перевести разницу значений счетчика в миллисекунды.
+   */
+  [[nodiscard]] double TicksToMs(uint64_t ticks) {
+    static const auto kFrequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    return ticks * 1000.0 / kFrequency;
+  }
+
+  /**
+   * @brief Вычислить минимум, среднее и 99-й перцентиль по скользящему окну.
+   */
+  void ComputeStats(const float* samples, size_t count, float& min, float& avg, float& p99) {
+    std::array<float, kHistoryFrames> sorted;
+    std::copy(samples, samples + count, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + count);
+
+    auto sum = 0.0F;
+    for (auto i = size_t{0}; i < count; i++) {
+      sum += sorted[i];
+    }
+
+    min = count ? sorted[0] : 0.0F;
+    avg = count ? sum / count : 0.0F;
+    p99 = count ? sorted[std::min(count - 1, count * 99 / 100)] : 0.0F;
+  }
+
+  /**
+   * @brief Отрисовать временную шкалу последнего кадра: строка на поток, ярус на уровень вложенности.
+   */
+  void DrawTimeline() {
+    if (last_frame_end <= last_frame_begin) {
+      return;
+    }
+
+    constexpr auto kRowHeight = 18.0F;
+    auto thread_count = uint32_t{0};
+    auto max_depth = uint32_t{0};
+    for (const auto& zone : last_frame_zones) {
+      thread_count = std::max(thread_count, zone.thread + 1);
+      max_depth = std::max(max_depth, zone.depth + 1);
+    }
+
+    auto width = std::max(ImGui::GetContentRegionAvail().x, 300.0F);
+    auto height = thread_count * max_depth * kRowHeight;
+    auto origin_pos = ImGui::GetCursorScreenPos();
+    auto* draw_list = ImGui::GetWindowDrawList();
+    auto frame_ticks = static_cast<double>(last_frame_end - last_frame_begin);
+
+    draw_list->AddRectFilled(origin_pos, ImVec2(origin_pos.x + width, origin_pos.y + height), IM_COL32(30, 30, 30, 255));
+
+    for (const auto& zone : last_frame_zones) {
+      auto begin = std::max(zone.begin, last_frame_begin);
+      auto end = std::min(zone.end, last_frame_end);
+      if (end <= begin) {
+        continue;
+      }
+
+      auto x0 = origin_pos.x + static_cast<float>((begin - last_frame_begin) / frame_ticks * width);
+      auto x1 = origin_pos.x + static_cast<float>((end - last_frame_begin) / frame_ticks * width);
+      auto y0 = origin_pos.y + (zone.thread * max_depth + zone.depth) * kRowHeight;
+      auto y1 = y0 + kRowHeight - 1.0F;
+
+      auto hash = std::hash<std::string_view>{}(zone.name);
+      auto color = IM_COL32(80 + hash % 150, 80 + (hash >> 8) % 150, 80 + (hash >> 16) % 150, 255);
+
+      draw_list->AddRectFilled(ImVec2(x0, y0), ImVec2(std::max(x1, x0 + 1.0F), y1), color);
+      if (x1 - x0 > 30.0F) {
+        draw_list->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y1), true);
+        draw_list->AddText(ImVec2(x0 + 2.0F, y0 + 1.0F), IM_COL32(0, 0, 0, 255), zone.name);
+        draw_list->PopClipRect();
+      }
+
+      if (ImGui::IsMouseHoveringRect(ImVec2(x0, y0), ImVec2(x1, y1))) {
+        ImGui::SetTooltip("%s: %.3f мс", zone.name, TicksToMs(zone.end - zone.begin));
+      }
+    }
+
+    ImGui::Dummy(ImVec2(width, height));
+  }
+
+  /**
+   * @brief Дописать строку в формате строкового литерала JSON, экранируя кавычки, обратную
+   * косую черту и управляющие символы.
+   */
+  void WriteJsonString(fmt::memory_buffer& out, std::string_view text) {
+    out.push_back('"');
+    for (auto c : text) {
+      // Байты UTF-8 больше 0x7F записываются как есть: JSON допускает их в строках.
+      if (c == '"' || c == '\\') {
+        out.push_back('\\');
+        out.push_back(c);
+      } else if (static_cast<unsigned char>(c) < 0x20) {
+        fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<unsigned>(c));
+      } else {
+        out.push_back(c);
+      }
+    }
+    out.push_back('"');
+  }
+
+} // namespace
+
+void SetEnabled(bool value) {
+  enabled.store(value, std::memory_order_relaxed);
+}
+
+bool IsEnabled() {
+  return enabled.load(std::memory_order_relaxed);
+}
+
+bool Begin(const char* name) {
+  if (!enabled.load(std::memory_order_relaxed)) {
+    return false;
+  }
+
+  auto& buffer = GetThreadBuffer();
+  if (buffer.depth >= kMaxDepth) {
+    return false;
+  }
+
+  buffer.stack[buffer.depth++] = {name, SDL_GetPerformanceCounter()};
+  return true;
+}
+
+void End() {
+  auto end = SDL_GetPerformanceCounter();
+  auto& buffer = GetThreadBuffer();
+  const auto& open = buffer.stack[--buffer.depth];
+
+  auto index = buffer.write_index.load(std::memory_order_relaxed);
+  auto& slot = buffer.zones[index % kZoneCapacity];
+  slot.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.zone = {open.name, open.begin, end, buffer.index, buffer.depth};
+  slot.sequence.store(index + 1, std::memory_order_release);
+  buffer.write_index.store(index + 1, std::memory_order_release);
+}
+
+const char* Intern(std::string_view name) {
+  std::lock_guard lock(intern_mutex);
+  return interned.emplace(name).first->c_str();
+}
+
+void BeginFrame() {
+  frame_begin = SDL_GetPerformanceCounter();
+
+  if (origin == 0) {
+    origin = frame_begin;
+  }
+}
+
+void EndFrame() {
+  auto frame_end = SDL_GetPerformanceCounter();
+  frame_zones.clear();
+
+  {
+    std::lock_guard lock(buffers_mutex);
+
+    for (auto& buffer : buffers) {
+      auto write_index = buffer->write_index.load(std::memory_order_acquire);
+
+      // Если поток записал больше зон, чем помещается в буфер, старые зоны потеряны.
+      if (write_index - buffer->read_index > kZoneCapacity) {
+        buffer->read_index = write_index - kZoneCapacity;
+      }
+
+      for (; buffer->read_index < write_index; buffer->read_index++) {
+        // Пока зона копируется, поток может переписать ячейку; такая копия отбрасывается.
+        const auto& slot = buffer->zones[buffer->read_index % kZoneCapacity];
+        if (slot.sequence.load(std::memory_order_acquire) != buffer->read_index + 1) {
+          continue;
+        }
+
+        auto zone = slot.zone;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == buffer->read_index + 1) {
+          frame_zones.push_back(zone);
+        }
+      }
+    }
+  }
+
+  for (auto& [name, zone_stats] : stats) {
+    zone_stats.frame_total = 0.0F;
+    zone_stats.seen = false;
+  }
+
+  for (const auto& zone : frame_zones) {
+    auto& zone_stats = stats[zone.name];
+    zone_stats.frame_total += static_cast<float>(TicksToMs(zone.end - zone.begin));
+    zone_stats.seen = true;
+
+    trace.push_back(zone);
+  }
+
+  while (trace.size() > kTraceCapacity) {
+    trace.pop_front();
+  }
+
+  for (auto& [name, zone_stats] : stats) {
+    if (zone_stats.seen) {
+      zone_stats.samples[zone_stats.count++ % kHistoryFrames] = zone_stats.frame_total;
+    }
+  }
+
+  frame_times[frame_count++ % kHistoryFrames] = static_cast<float>(TicksToMs(frame_end - frame_begin));
+  last_frame_begin = frame_begin;
+  last_frame_end = frame_end;
+  last_frame_zones.swap(frame_zones);
+}
+
+void DrawWindow() {
+  ImGui::SetNextWindowPos(ImVec2(420.0F, 10.0F), ImGuiCond_FirstUseEver);
+  ImGui::Begin("Профилировщик", nullptr, ImGuiWindowFlags_None);
+
+  auto is_enabled = IsEnabled();
+  if (ImGui::Checkbox("Запись", &is_enabled)) {
+    SetEnabled(is_enabled);
+  }
+
+  ImGui::SameLine();
+  if (ImGui::Button("Экспорт в Chrome trace")) {
+    ExportChromeTrace("trace.json");
+  }
+
+  float min, avg, p99;
+  auto frames = std::min(frame_count, kHistoryFrames);
+  ComputeStats(frame_times.data(), frames, min, avg, p99);
+  ImGui::Text("Кадр: мин %.2f мс, сред %.2f мс, p99 %.2f мс", min, avg, p99);
+
+  if (ImGui::BeginTable("zones", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+    ImGui::TableSetupColumn("Зона");
+    ImGui::TableSetupColumn("Мин, мс");
+    ImGui::TableSetupColumn("Сред, мс");
+    ImGui::TableSetupColumn("p99, мс");
+    ImGui::TableHeadersRow();
+
+    for (const auto& [name, zone_stats] : stats) {
+      ComputeStats(zone_stats.samples.data(), std::min(zone_stats.count, kHistoryFrames), min, avg, p99);
+
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::TextUnformatted(name.data(), name.data() + name.size());
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", min);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", avg);
+      ImGui::TableNextColumn();
+      ImGui::Text("%.3f", p99);
+    }
+
+    ImGui::EndTable();
+  }
+
+  ImGui::SeparatorText("Последний кадр");
+  DrawTimeline();
+
+  ImGui::End();
+}
+
+bool ExportChromeTrace(const std::string& path) {
+  auto* file = std::fopen(path.c_str(), "w");
+  if (!file) {
+    Logger::Error("Не удалось открыть файл трассировки '{}'...", path);
+    return false;
+  }
+
+  auto frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+  auto to_us = [frequency](uint64_t ticks) { return ticks * 1'000'000.0 / frequency; };
+
+  fmt::memory_buffer out;
+  fmt::format_to(std::back_inserter(out), "{{\"traceEvents\":[\n");
+
+  auto first = true;
+  for (const auto& zone : trace) {
+    fmt::format_to(std::back_inserter(out), "{}{{\"name\":", first ? "" : ",\n");
+    WriteJsonString(out, zone.name);
+    fmt::format_to(
+      std::back_inserter(out), ",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", zone.thread,
+      to_us(std::max(zone.begin, origin) - origin), to_us(zone.end - zone.begin)
+    );
+    first = false;
+  }
+
+  fmt::format_to(std::back_inserter(out), "\n],\"displayTimeUnit\":\"ms\"}}\n");
+
+  auto written = std::fwrite(out.data(), 1, out.size(), file) == out.size();
+  std::fclose(file);
+
+  if (written) {
+    Logger::Info("Трассировка из {} зон сохранена в '{}'.", trace.size(), path);
+  }
+
+  return written;
+}
+
+} // namespace gb::Profiler
@@ -0,0 +1,107 @@
+#ifndef GUIDING_BREEZE_SRC_PROFILER_PROFILER_H
+#define GUIDING_BREEZE_SRC_PROFILER_PROFILER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Склейка идентификаторов для уникальных имен переменных макросов.
+#define GB_PROFILE_CONCAT_IMPL(a, b) a##b
+#define GB_PROFILE_CONCAT(a, b) GB_PROFILE_CONCAT_IMPL(a, b)
+
+// Макрос замера времени выполнения до конца текущей области видимости.
+// Имя зоны должно жить до конца работы программы (строковый литерал или Profiler::Intern).
+#define GB_PROFILE_ZONE(name) \
+  const ::gb::Profiler::ScopedZone GB_PROFILE_CONCAT(gb_profile_zone_, __LINE__)(name)
+
+namespace gb::Profiler {
+
+/**
+ * @brief Включить или выключить запись зон.
+ *
+ * @param enabled Флаг записи.
+ */
+void SetEnabled(bool enabled);
+
+/**
+ * @brief Проверить, включена ли запись зон.
+ */
+[[nodiscard]] bool IsEnabled();
+
+/**
+ * @brief Начать зону в текущем потоке.
+ *
+ * @param name Имя зоны со статическим временем жизни.
+ * @return true Если зона начата и для нее нужно вызвать End.
+ */
+bool Begin(const char* name);
+
+/**
+ * @brief Завершить последнюю начатую в текущем потоке зону.
+ */
+void End();
+
+/**
+ * @brief Получить указатель на строку со временем жизни до конца работы программы.
+ *
+ * @param name Строка.
+ * @return const char* Указатель на сохраненную копию строки; для одинаковых строк совпадает.
+ */
+[[nodiscard]] const char* Intern(std::string_view name);
+
+/**
+ * @brief Отметить начало кадра.
+ *
+ * @note Вызывается из главного потока.
+ */
+void BeginFrame();
+
+/**
+ * @brief Отметить конец кадра и собрать записанные потоками зоны.
+ *
+ * @note Вызывается из главного потока.
+ */
+void EndFrame();
+
+/**
+ * @brief Отрисовать окно профилировщика ImGui.
+ *
+ * @note Вызывается из главного потока между ImGui::NewFrame и ImGui::Render.
+ */
+void DrawWindow();
+
+/**
+ * @brief Сохранить накопленные зоны в формате Chrome trace JSON.
+ *
+ * @param path Путь к файлу.
+ * @return true Если файл записан.
+ * @note Файл открывается в chrome://tracing или ui.perfetto.dev.
+ */
+bool ExportChromeTrace(const std::string& path);
+
+/**
+ * @brief Зона, замеряющая время до конца области видимости.
+ */
+class ScopedZone final {
+private:
+  bool active_;
+
+public:
+  explicit ScopedZone(const char* name) : active_(Begin(name)) {}
+  ScopedZone(const ScopedZone&) = delete;
+  ScopedZone(ScopedZone&&) = delete;
+
+  ~ScopedZone() noexcept {
+    if (active_) {
+      End();
+    }
+  }
+
+public:
+  ScopedZone& operator=(const ScopedZone&) = delete;
+  ScopedZone& operator=(ScopedZone&&) = delete;
+};
+
+} // namespace gb::Profiler
+
+#endif // GUIDING_BREEZE_SRC_PROFILER_PROFILER_H